@@ -6,6 +6,8 @@
 
 #include <bit>
 
+LOG_CHANNEL(dump_log, "AudioDumper");
+
 AudioDumper::AudioDumper()
 {
 }
@@ -26,14 +28,54 @@ void AudioDumper::Open(AudioChannelCnt ch, AudioFreq sample_rate, AudioSampleSiz
 		path += id + "_";
 	}
 	path += date_time::current_time_narrow<'_'>() + ".wav";
-	m_output.open(path, fs::rewrite);
+
+	if (!m_output.open(path, fs::rewrite))
+	{
+		dump_log.error("Failed to create %s (%s)", path, fs::g_tls_error);
+		m_header.FMT.NumChannels = 0;
+		return;
+	}
+
 	m_output.seek(sizeof(m_header));
+
+	// Enough room for two seconds of audio
+	m_ring.set_buf_size(std::max<u64>(u64{m_header.FMT.ByteRate} * 2, writer_chunk_size * 4));
+	m_written = 0;
+	m_dropped_blocks = 0;
+	m_dropped_bytes = 0;
+
+	m_writer = std::make_unique<named_thread<std::function<void()>>>("Audio Dump Thread", [this]()
+	{
+		writer_loop();
+	});
 }
 
 void AudioDumper::Close()
 {
 	if (GetCh())
 	{
+		if (m_writer)
+		{
+			// The writer drains the ring before exiting
+			auto& writer = *m_writer;
+			writer = thread_state::aborting;
+			m_signal++;
+			m_signal.notify_one();
+			writer();
+			m_writer.reset();
+		}
+
+		if (const u64 dropped = m_dropped_blocks)
+		{
+			dump_log.error("%u audio blocks (%u bytes) were dropped because the writer could not keep up", dropped, m_dropped_bytes.load());
+		}
+
+		const u32 written = static_cast<u32>(m_written);
+
+		m_header.Size = written;
+		m_header.RIFF.Size = sizeof(WAVHeader::RIFFHeader) + sizeof(WAVHeader::FMTHeader) + written;
+		m_header.FACT.SampleLength = written / (GetCh() * GetSampleSize());
+
 		if (m_header.Size & 1)
 		{
 			const u8 pad_byte = 0;
@@ -48,6 +90,31 @@ void AudioDumper::Close()
 	}
 }
 
+void AudioDumper::writer_loop()
+{
+	std::vector<u8> chunk(writer_chunk_size);
+
+	while (true)
+	{
+		const u64 signal = m_signal;
+		const bool exiting = thread_ctrl::state() == thread_state::aborting;
+
+		while (const u64 size = m_ring.pop(chunk.data(), chunk.size(), true))
+		{
+			ensure(m_output.write(chunk.data(), size) == size);
+			m_written += size;
+		}
+
+		if (exiting)
+		{
+			break;
+		}
+
+		// Wake up periodically even without a signal so that small amounts of data still reach the disk
+		thread_ctrl::wait_on(m_signal, signal, 100'000);
+	}
+}
+
 void AudioDumper::WriteData(const void* buffer, u32 size)
 {
 	if (GetCh() && size && buffer)
@@ -57,6 +124,8 @@ void AudioDumper::WriteData(const void* buffer, u32 size)
 
 		ensure(size - sample_cnt_per_ch * blk_size == 0);
 
+		u64 pushed = 0;
+
 		if constexpr (std::endian::big == std::endian::native)
 		{
 			std::vector<u8> tmp_buf(size);
@@ -76,15 +145,24 @@ void AudioDumper::WriteData(const void* buffer, u32 size)
 				}
 			}
 
-			ensure(m_output.write(tmp_buf.data(), size) == size);
+			pushed = m_ring.push(tmp_buf.data(), size);
 		}
 		else
 		{
-			ensure(m_output.write(buffer, size) == size);
+			pushed = m_ring.push(buffer, size);
 		}
 
-		m_header.Size += size;
-		m_header.RIFF.Size += size;
-		m_header.FACT.SampleLength += sample_cnt_per_ch;
+		if (!pushed)
+		{
+			m_dropped_blocks++;
+			m_dropped_bytes += size;
+			return;
+		}
+
+		if (m_ring.get_used_size() >= writer_chunk_size)
+		{
+			m_signal++;
+			m_signal.notify_one();
+		}
 	}
 }
@@ -1,9 +1,15 @@
 #pragma once
 
 #include "util/types.hpp"
+#include "util/atomic.hpp"
 #include "Utilities/File.h"
+#include "Utilities/Thread.h"
+#include "Utilities/simple_ringbuf.h"
 #include "Emu/Audio/AudioBackend.h"
 
+#include <functional>
+#include <memory>
+
 struct WAVHeader
 {
 	struct RIFFHeader
@@ -72,11 +78,26 @@ struct WAVHeader
 	}
 };
 
+// Writes the audio output to a WAV file in the cache directory.
+// Blocks are queued to a ring buffer and written in large chunks by a dedicated thread, so disk stalls don't reach the audio thread.
 class AudioDumper
 {
 	WAVHeader m_header{};
 	fs::file m_output{};
 
+	simple_ringbuf m_ring{};
+	atomic_t<u64> m_signal = 0; // Wakes the writer thread
+	std::unique_ptr<named_thread<std::function<void()>>> m_writer{};
+	u64 m_written = 0; // Owned by the writer thread until it is joined
+
+	// Blocks that did not fit into the ring buffer
+	atomic_t<u64> m_dropped_blocks = 0;
+	atomic_t<u64> m_dropped_bytes = 0;
+
+	static constexpr u64 writer_chunk_size = 256 * 1024;
+
+	void writer_loop();
+
 public:
 	AudioDumper();
 	~AudioDumper();
@@ -87,4 +108,5 @@ public:
 	void WriteData(const void* buffer, u32 size);
 	u16 GetCh() const { return m_header.FMT.NumChannels; }
 	u16 GetSampleSize() const { return m_header.FMT.BitsPerSample / 8; }
+	u64 GetDroppedBlocks() const { return m_dropped_blocks; }
 };
@@ -1,6 +1,7 @@
 #include "stdafx.h"
 #include "Emu/Audio/audio_resampler.h"
 #include <algorithm>
+#include <cmath>
 
 audio_resampler::audio_resampler()
 {
@@ -15,6 +16,7 @@ audio_resampler::~audio_resampler()
 void audio_resampler::set_params(AudioChannelCnt ch_cnt, AudioFreq freq)
 {
 	flush();
+	channels = static_cast<u32>(ch_cnt);
 	resampler.setChannels(static_cast<u32>(ch_cnt));
 	resampler.setSampleRate(static_cast<u32>(freq));
 }
@@ -23,31 +25,78 @@ f64 audio_resampler::set_tempo(f64 new_tempo)
 {
 	new_tempo = std::clamp(new_tempo, RESAMPLER_MIN_FREQ_VAL, RESAMPLER_MAX_FREQ_VAL);
 	resampler.setTempo(new_tempo);
+
+	const bool new_passthrough = std::abs(new_tempo - 1.0) < RESAMPLER_PASSTHROUGH_EPSILON;
+
+	if (passthrough && !new_passthrough)
+	{
+		// Hand the queued samples over to SoundTouch so that nothing is dropped
+		const u32 queued = samples_available();
+
+		if (queued)
+		{
+			resampler.putSamples(passthrough_buf.data() + passthrough_pos, queued);
+		}
+
+		passthrough_buf.clear();
+		passthrough_pos = 0;
+	}
+	else if (!passthrough && new_passthrough)
+	{
+		// Push the remaining input through, its output is returned before any new samples
+		resampler.flush();
+	}
+
+	passthrough = new_passthrough;
 	return new_tempo;
 }
 
 void audio_resampler::put_samples(const f32* buf, u32 sample_cnt)
 {
-	resampler.putSamples(buf, sample_cnt);
+	if (!passthrough)
+	{
+		resampler.putSamples(buf, sample_cnt);
+		return;
+	}
+
+	if (passthrough_pos)
+	{
+		// Drop the samples that were already returned by get_samples
+		passthrough_buf.erase(passthrough_buf.begin(), passthrough_buf.begin() + passthrough_pos);
+		passthrough_pos = 0;
+	}
+
+	passthrough_buf.insert(passthrough_buf.end(), buf, buf + usz{sample_cnt} * channels);
 }
 
 std::pair<f32* /* buffer */, u32 /* samples */> audio_resampler::get_samples(u32 sample_cnt)
 {
-	f32 *const buf = resampler.bufBegin();
-	return std::make_pair(buf, resampler.receiveSamples(sample_cnt));
+	if (!passthrough || resampler.numSamples())
+	{
+		f32 *const buf = resampler.bufBegin();
+		return std::make_pair(buf, resampler.receiveSamples(sample_cnt));
+	}
+
+	const u32 count = std::min(sample_cnt, static_cast<u32>((passthrough_buf.size() - passthrough_pos) / channels));
+	f32* const buf = passthrough_buf.data() + passthrough_pos;
+	passthrough_pos += usz{count} * channels;
+
+	return std::make_pair(buf, count);
 }
 
 u32 audio_resampler::samples_available() const
 {
-	return resampler.numSamples();
+	return resampler.numSamples() + static_cast<u32>((passthrough_buf.size() - passthrough_pos) / channels);
 }
 
 f64 audio_resampler::get_resample_ratio()
 {
-	return resampler.getInputOutputSampleRatio();
+	return passthrough ? 1.0 : resampler.getInputOutputSampleRatio();
 }
 
 void audio_resampler::flush()
 {
 	resampler.clear();
+	passthrough_buf.clear();
+	passthrough_pos = 0;
 }
@@ -3,6 +3,8 @@
 #include "util/types.hpp"
 #include "Emu/Audio/AudioBackend.h"
 
+#include <vector>
+
 #ifndef _MSC_VER
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wsuggest-override"
@@ -14,6 +16,7 @@
 
 constexpr f64 RESAMPLER_MAX_FREQ_VAL = 1.0;
 constexpr f64 RESAMPLER_MIN_FREQ_VAL = 0.1;
+constexpr f64 RESAMPLER_PASSTHROUGH_EPSILON = 0.001; // Tempos this close to 1.0 bypass SoundTouch
 
 class audio_resampler
 {
@@ -34,4 +37,10 @@ public:
 
 private:
 	soundtouch::SoundTouch resampler{};
+
+	// Samples are only routed through SoundTouch while the tempo differs from 1.0
+	bool passthrough = true;
+	u32 channels = 2;
+	std::vector<f32> passthrough_buf{};
+	usz passthrough_pos = 0; // Read offset into passthrough_buf, in floats
 };
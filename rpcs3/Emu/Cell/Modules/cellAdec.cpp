@@ -1028,7 +1028,7 @@ error_code cellAdecGetPcm(u32 handle, vm::ptr<float> outBuffer)
 			in_f[5] = reinterpret_cast<float*>(frame->extended_data[5]);
 			in_f[6] = reinterpret_cast<float*>(frame->extended_data[6]);
 			in_f[7] = reinterpret_cast<float*>(frame->extended_data[7]);
-			for (u32 i = 0; i < af.size / 24; i++)
+			for (u32 i = 0; i < af.size / 32; i++)
 			{
 				outBuffer[i * 8 + 0] = in_f[0][i];
 				outBuffer[i * 8 + 1] = in_f[1][i];
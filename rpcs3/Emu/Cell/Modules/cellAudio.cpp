@@ -8,6 +8,23 @@
 
 #include <cmath>
 
+#if defined(ARCH_X64)
+#include "emmintrin.h"
+#endif
+
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#endif
+
+#ifdef ARCH_ARM64
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif
+#undef FORCE_INLINE
+#include "Emu/CPU/sse2neon.h"
+#endif
+
 LOG_CHANNEL(cellAudio);
 
 vm::gvar<char, AUDIO_PORT_OFFSET * AUDIO_PORT_COUNT> g_audio_buffer;
@@ -100,6 +117,9 @@ void cell_audio_config::reset(bool backend_changed)
 	desired_full_buffers = buffering_enabled ? static_cast<u32>(desired_buffer_duration / audio_block_period) + 3 : 2;
 	num_allocated_buffers = desired_full_buffers + EXTRA_AUDIO_BUFFERS;
 
+	adaptive_buffering_enabled = buffering_enabled && raw.adaptive_buffering;
+	minimum_buffer_duration = static_cast<u64>(audio_min_buffer_duration * 1000) * 1000llu; // Same ms truncation as desired_buffer_duration, which must not be lower
+
 	fully_untouched_timeout = static_cast<u64>(audio_block_period) * 2;
 	partially_untouched_timeout = static_cast<u64>(audio_block_period) * 4;
 
@@ -186,9 +206,41 @@ float* audio_ringbuffer::get_buffer(u32 num) const
 
 u32 audio_ringbuffer::backend_write_callback(u32 size, void *buf)
 {
-	if (!backend_active.observe()) backend_active = true;
+	if (!backend_active.observe())
+	{
+		backend_active = true;
+
+		// Don't count the time spent paused as jitter
+		last_callback_time = 0;
+	}
+
+	// Measure how regularly the backend asks for data
+	const u64 now = get_timestamp();
+
+	if (last_callback_time)
+	{
+		const f32 interval = static_cast<f32>(now - last_callback_time);
+
+		if (average_callback_interval == 0.0f)
+		{
+			average_callback_interval = interval;
+		}
+
+		average_callback_interval += (interval - average_callback_interval) * callback_average_alpha;
+		average_callback_jitter += (std::abs(interval - average_callback_interval) - average_callback_jitter) * callback_average_alpha;
+		callback_jitter.release(static_cast<u32>(average_callback_jitter));
+	}
+
+	const u32 popped = static_cast<u32>(cb_ringbuf.pop(buf, size, true));
+
+	if (popped < size && last_callback_time)
+	{
+		// The backend had to play silence
+		underruns++;
+	}
 
-	return static_cast<u32>(cb_ringbuf.pop(buf, size, true));
+	last_callback_time = now;
+	return popped;
 }
 
 u64 audio_ringbuffer::get_timestamp()
@@ -317,7 +369,11 @@ void audio_ringbuffer::commit_data(f32* buf, u32 sample_cnt)
 		AudioBackend::convert_to_s16(sample_cnt_out, buf, buf);
 	}
 
-	cb_ringbuf.push(buf, sample_cnt_out * cfg.audio_sample_size);
+	if (!cb_ringbuf.push(buf, sample_cnt_out * cfg.audio_sample_size))
+	{
+		// The backend is consuming slower than we produce, this block is dropped
+		overruns++;
+	}
 }
 
 void audio_ringbuffer::play()
@@ -619,6 +675,7 @@ namespace audio
 			.audio_device = g_cfg.audio.audio_device,
 			.buffering_enabled = static_cast<bool>(g_cfg.audio.enable_buffering),
 			.desired_buffer_duration = g_cfg.audio.desired_buffer_duration,
+			.adaptive_buffering = static_cast<bool>(g_cfg.audio.adaptive_buffering),
 			.enable_time_stretching = static_cast<bool>(g_cfg.audio.enable_time_stretching),
 			.time_stretching_threshold = g_cfg.audio.time_stretching_threshold,
 			.convert_to_s16 = static_cast<bool>(g_cfg.audio.convert_to_s16),
@@ -645,6 +702,7 @@ namespace audio
 				raw.audio_device != new_raw.audio_device ||
 				raw.desired_buffer_duration != new_raw.desired_buffer_duration ||
 				raw.buffering_enabled != new_raw.buffering_enabled ||
+				raw.adaptive_buffering != new_raw.adaptive_buffering ||
 				raw.time_stretching_threshold != new_raw.time_stretching_threshold ||
 				raw.enable_time_stretching != new_raw.enable_time_stretching ||
 				raw.convert_to_s16 != new_raw.convert_to_s16 ||
@@ -684,6 +742,52 @@ void cell_audio_thread::reset_counters()
 	m_dynamic_period = 0;
 	m_backend_failed = false;
 	m_audio_should_restart = true;
+	m_adaptive_buffer_duration = cfg.minimum_buffer_duration;
+	m_adaptive_last_change = m_start_time;
+	m_adaptive_underruns = 0;
+}
+
+void cell_audio_thread::update_adaptive_buffering(u64 timestamp)
+{
+	const u64 jitter = ringbuffer->get_callback_jitter();
+	const u64 underruns = ringbuffer->get_underruns();
+
+	if (underruns != m_adaptive_underruns)
+	{
+		// Grow quickly after an underrun
+		m_adaptive_buffer_duration += std::max<u64>(cfg.audio_block_period, jitter * 2);
+		m_adaptive_underruns = underruns;
+		m_adaptive_last_change = timestamp;
+	}
+	else if (timestamp - m_adaptive_last_change >= cfg.adaptive_shrink_interval)
+	{
+		// Shrink slowly towards the jitter floor while playback is stable
+		const u64 floor = cfg.minimum_buffer_duration + jitter * 2;
+
+		if (m_adaptive_buffer_duration > floor)
+		{
+			m_adaptive_buffer_duration -= std::min<u64>(m_adaptive_buffer_duration - floor, cfg.audio_block_period / 2);
+		}
+
+		m_adaptive_last_change = timestamp;
+	}
+
+	m_adaptive_buffer_duration = std::clamp(m_adaptive_buffer_duration, cfg.minimum_buffer_duration, cfg.desired_buffer_duration);
+}
+
+u64 cell_audio_thread::get_desired_buffer_duration() const
+{
+	return cfg.adaptive_buffering_enabled ? m_adaptive_buffer_duration : cfg.desired_buffer_duration;
+}
+
+u32 cell_audio_thread::get_desired_full_buffers() const
+{
+	if (!cfg.adaptive_buffering_enabled)
+	{
+		return cfg.desired_full_buffers;
+	}
+
+	return std::min(static_cast<u32>(m_adaptive_buffer_duration / cfg.audio_block_period) + 3, cfg.desired_full_buffers);
 }
 
 cell_audio_thread::cell_audio_thread()
@@ -792,7 +896,7 @@ void cell_audio_thread::operator()()
 			{
 				// Restart algorithm
 				cellAudio.trace("restarting audio");
-				ringbuffer->enqueue_silence(cfg.desired_full_buffers, true);
+				ringbuffer->enqueue_silence(get_desired_full_buffers(), true);
 				finish_port_volume_stepping();
 				m_average_playtime = static_cast<f32>(ringbuffer->get_enqueued_playtime());
 				untouched_expected = 0;
@@ -826,11 +930,24 @@ void cell_audio_thread::operator()()
 			const u32 untouched    = std::get<2>(tag_info);
 			const u32 incomplete   = std::get<3>(tag_info);
 
+			if (cfg.adaptive_buffering_enabled)
+			{
+				update_adaptive_buffering(timestamp);
+			}
+
+			const u64 desired_buffer_duration = get_desired_buffer_duration();
+
+			m_buffer_stats.enqueued_us.release(static_cast<u32>(enqueued_playtime));
+			m_buffer_stats.target_us.release(static_cast<u32>(desired_buffer_duration));
+			m_buffer_stats.jitter_us.release(ringbuffer->get_callback_jitter());
+			m_buffer_stats.underruns.release(ringbuffer->get_underruns());
+			m_buffer_stats.overruns.release(ringbuffer->get_overruns());
+
 			// Ratio between the rolling average of the audio period, and the desired audio period
 			const f32 average_playtime_ratio = m_average_playtime / cfg.audio_buffer_length;
 
 			// Use the above average ratio to decide how much buffer we should be aiming for
-			f32 desired_duration_adjusted = cfg.desired_buffer_duration + (cfg.audio_block_period / 2.0f);
+			f32 desired_duration_adjusted = desired_buffer_duration + (cfg.audio_block_period / 2.0f);
 			if (average_playtime_ratio < 1.0f)
 			{
 				desired_duration_adjusted /= std::max(average_playtime_ratio, 0.25f);
@@ -1029,6 +1146,96 @@ audio_port* cell_audio_thread::open_port()
 	return nullptr;
 }
 
+namespace
+{
+	// Loads 4 big-endian floats from guest memory
+	inline __m128 load_be_ps(const be_t<f32>* src)
+	{
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+		const __m128i w = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xb1), 0xb1);
+		return _mm_castsi128_ps(_mm_or_si128(_mm_slli_epi16(w, 8), _mm_srli_epi16(w, 8)));
+	}
+
+	// Adds the two low lanes of v to dst
+	inline void accumulate_2(float* dst, __m128 v)
+	{
+		const __m128 sum = _mm_add_ps(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(dst))), v);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_castps_si128(sum));
+	}
+
+	inline void accumulate_4(float* dst, __m128 v)
+	{
+		_mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), v));
+	}
+
+	template <u32 out_channels>
+	void mix_stereo_port(float* out_buffer, const be_t<f32>* buf, const float* gains)
+	{
+		// Two frames per iteration
+		for (u32 i = 0; i < AUDIO_BUFFER_SAMPLES; i += 2)
+		{
+			const __m128 g = _mm_set_ps(gains[i + 1], gains[i + 1], gains[i], gains[i]);
+			const __m128 v = _mm_mul_ps(load_be_ps(buf + i * 2), g);
+
+			if constexpr (out_channels == 2)
+			{
+				accumulate_4(out_buffer + i * 2, v);
+			}
+			else
+			{
+				accumulate_2(out_buffer + i * out_channels, v);
+				accumulate_2(out_buffer + (i + 1) * out_channels, _mm_movehl_ps(v, v));
+			}
+		}
+	}
+
+	template <u32 out_channels, AudioChannelCnt downmix>
+	void mix_surround_port(float* out_buffer, const be_t<f32>* buf, const float* gains)
+	{
+		static constexpr float minus_3db = 0.707f; // value taken from https://www.dolby.com/us/en/technologies/a-guide-to-dolby-metadata.pdf
+
+		for (u32 i = 0; i < AUDIO_BUFFER_SAMPLES; i++)
+		{
+			const __m128 g = _mm_set1_ps(gains[i]);
+			const __m128 front = _mm_mul_ps(load_be_ps(buf + i * 8 + 0), g); // left, right, center, low_freq
+			const __m128 back = _mm_mul_ps(load_be_ps(buf + i * 8 + 4), g);  // side_left, side_right, rear_left, rear_right
+			float* out = out_buffer + i * out_channels;
+
+			if constexpr (downmix == AudioChannelCnt::STEREO)
+			{
+				// Don't mix in the lfe as per dolby specification and based on documentation
+				const __m128 sides = _mm_add_ps(back, _mm_movehl_ps(back, back));
+				const __m128 center = _mm_shuffle_ps(front, front, _MM_SHUFFLE(2, 2, 2, 2));
+				accumulate_2(out, _mm_add_ps(_mm_mul_ps(front, _mm_set1_ps(minus_3db)), _mm_mul_ps(_mm_add_ps(center, sides), _mm_set1_ps(0.5f))));
+			}
+			else if constexpr (out_channels == 2)
+			{
+				accumulate_2(out, front);
+			}
+			else if constexpr (downmix == AudioChannelCnt::SURROUND_5_1)
+			{
+				// When using 7.1 ouput, out[4] and out[5] are the rear channels, so the side channels need to be mixed into out[6] and out[7]
+				accumulate_4(out, front);
+				accumulate_2(out + (out_channels == 6 ? 4 : 6), _mm_add_ps(back, _mm_movehl_ps(back, back)));
+			}
+			else if constexpr (out_channels == 6)
+			{
+				accumulate_4(out, front);
+				accumulate_2(out + 4, back);
+			}
+			else
+			{
+				accumulate_4(out, front);
+				accumulate_4(out + 4, _mm_shuffle_ps(back, back, _MM_SHUFFLE(1, 0, 3, 2)));
+			}
+		}
+	}
+}
+
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic pop
+#endif
+
 template <AudioChannelCnt channels, AudioChannelCnt downmix>
 void cell_audio_thread::mix(float* out_buffer, s32 offset)
 {
@@ -1042,119 +1249,51 @@ void cell_audio_thread::mix(float* out_buffer, s32 offset)
 	// Reset out_buffer
 	std::memset(out_buffer, 0, out_buffer_sz * sizeof(float));
 
+	// Per sample gain of the current port for this block
+	alignas(16) std::array<float, AUDIO_BUFFER_SAMPLES> gains;
+
 	// mixing
 	for (auto& port : ports)
 	{
 		if (port.state != audio_port_state::started) continue;
 
-		auto buf = port.get_vm_ptr(offset);
-
-		static constexpr float minus_3db = 0.707f; // value taken from https://www.dolby.com/us/en/technologies/a-guide-to-dolby-metadata.pdf
-		float m = master_volume;
+		const be_t<f32>* buf = port.get_vm_ptr(offset);
 
 		// part of cellAudioSetPortLevel functionality
 		// spread port volume changes over 13ms
-		auto step_volume = [master_volume, &m](audio_port& port)
+		if (port.level_set.load().inc == 0.0f)
 		{
-			const auto param = port.level_set.load();
-
-			if (param.inc != 0.0f)
+			gains.fill(port.level * master_volume);
+		}
+		else
+		{
+			for (float& gain : gains)
 			{
-				port.level += param.inc;
-				const bool dec = param.inc < 0.0f;
+				const auto param = port.level_set.load();
 
-				if ((!dec && param.value - port.level <= 0.0f) || (dec && param.value - port.level >= 0.0f))
+				if (param.inc != 0.0f)
 				{
-					port.level = param.value;
-					port.level_set.compare_and_swap(param, { param.value, 0.0f });
+					port.level += param.inc;
+					const bool dec = param.inc < 0.0f;
+
+					if ((!dec && param.value - port.level <= 0.0f) || (dec && param.value - port.level >= 0.0f))
+					{
+						port.level = param.value;
+						port.level_set.compare_and_swap(param, { param.value, 0.0f });
+					}
 				}
-			}
 
-			m = port.level * master_volume;
-		};
+				gain = port.level * master_volume;
+			}
+		}
 
 		if (port.num_channels == 2)
 		{
-			for (u32 out = 0, in = 0; out < out_buffer_sz; out += out_channels, in += 2)
-			{
-				step_volume(port);
-
-				const float left  = buf[in + 0] * m;
-				const float right = buf[in + 1] * m;
-
-				out_buffer[out + 0] += left;
-				out_buffer[out + 1] += right;
-			}
+			mix_stereo_port<out_channels>(out_buffer, buf, gains.data());
 		}
 		else if (port.num_channels == 8)
 		{
-			for (u32 out = 0, in = 0; out < out_buffer_sz; out += out_channels, in += 8)
-			{
-				step_volume(port);
-
-				const float left       = buf[in + 0] * m;
-				const float right      = buf[in + 1] * m;
-				const float center     = buf[in + 2] * m;
-				const float low_freq   = buf[in + 3] * m;
-				const float side_left  = buf[in + 4] * m;
-				const float side_right = buf[in + 5] * m;
-				const float rear_left  = buf[in + 6] * m;
-				const float rear_right = buf[in + 7] * m;
-
-				if constexpr (downmix == AudioChannelCnt::STEREO)
-				{
-					// Don't mix in the lfe as per dolby specification and based on documentation
-					const float mid = center * 0.5f;
-					out_buffer[out + 0] += left * minus_3db + mid + side_left * 0.5f + rear_left * 0.5f;
-					out_buffer[out + 1] += right * minus_3db + mid + side_right * 0.5f + rear_right * 0.5f;
-				}
-				else if constexpr (downmix == AudioChannelCnt::SURROUND_5_1)
-				{
-					out_buffer[out + 0] += left;
-					out_buffer[out + 1] += right;
-
-					if constexpr (out_channels >= 6) // Only mix the surround channels into the output if surround output is configured
-					{
-						out_buffer[out + 2] += center;
-						out_buffer[out + 3] += low_freq;
-
-						if constexpr (out_channels == 6)
-						{
-							out_buffer[out + 4] += side_left + rear_left;
-							out_buffer[out + 5] += side_right + rear_right;
-						}
-						else // When using 7.1 ouput, out_buffer[out + 4] and out_buffer[out + 5] are the rear channels, so the side channels need to be mixed into [out + 6] and [out + 7]
-						{
-							out_buffer[out + 6] += side_left + rear_left;
-							out_buffer[out + 7] += side_right + rear_right;
-						}
-					}
-				}
-				else
-				{
-					out_buffer[out + 0] += left;
-					out_buffer[out + 1] += right;
-
-					if constexpr (out_channels >= 6) // Only mix the surround channels into the output if surround output is configured
-					{
-						out_buffer[out + 2] += center;
-						out_buffer[out + 3] += low_freq;
-
-						if constexpr (out_channels == 6)
-						{
-							out_buffer[out + 4] += side_left;
-							out_buffer[out + 5] += side_right;
-						}
-						else
-						{
-							out_buffer[out + 4] += rear_left;
-							out_buffer[out + 5] += rear_right;
-							out_buffer[out + 6] += side_left;
-							out_buffer[out + 7] += side_right;
-						}
-					}
-				}
-			}
+			mix_surround_port<out_channels, downmix>(out_buffer, buf, gains.data());
 		}
 		else
 		{
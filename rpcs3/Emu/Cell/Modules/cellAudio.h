@@ -208,6 +208,7 @@ struct cell_audio_config
 		std::string audio_device{};
 		bool buffering_enabled = false;
 		s64 desired_buffer_duration = 0;
+		bool adaptive_buffering = false;
 		bool enable_time_stretching = false;
 		s64 time_stretching_threshold = 0;
 		bool convert_to_s16 = false;
@@ -247,6 +248,12 @@ struct cell_audio_config
 	u32 desired_full_buffers = 0;
 	u32 num_allocated_buffers = 0; // number of ringbuffer buffers
 
+	// Adaptive buffering moves the buffering target between minimum_buffer_duration and desired_buffer_duration
+	// It grows after backend underruns and slowly shrinks back towards the measured callback jitter
+	bool adaptive_buffering_enabled = false;
+	u64 minimum_buffer_duration = 0; // usecs
+	static constexpr u64 adaptive_shrink_interval = 2'000'000; // usecs without underruns before the target is lowered
+
 	static constexpr f32 period_average_alpha = 0.02f; // alpha factor for the m_average_period rolling average
 
 	static constexpr s64 period_comparison_margin = 250; // when comparing the current period time with the desired period, if it is below this number of usecs we do not wait any longer
@@ -303,6 +310,16 @@ private:
 
 	u32 cur_pos = 0;
 
+	// Backend telemetry
+	atomic_t<u64> underruns = 0;
+	atomic_t<u64> overruns = 0;
+	atomic_t<u32> callback_jitter = 0; // usecs
+	u64 last_callback_time = 0;
+	f32 average_callback_interval = 0.0f;
+	f32 average_callback_jitter = 0.0f;
+
+	static constexpr f32 callback_average_alpha = 0.05f;
+
 	bool get_backend_playing() const
 	{
 		return backend->IsPlaying();
@@ -330,6 +347,22 @@ public:
 	u64 get_enqueued_samples() const;
 	u64 get_enqueued_playtime() const;
 
+	u64 get_underruns() const
+	{
+		return underruns;
+	}
+
+	u64 get_overruns() const
+	{
+		return overruns;
+	}
+
+	// Rolling average of the deviation between backend callback intervals
+	u32 get_callback_jitter() const
+	{
+		return callback_jitter;
+	}
+
 	bool is_playing() const
 	{
 		return playing;
@@ -377,6 +410,14 @@ private:
 	void update_config(bool backend_changed);
 	void reset_counters();
 
+	u64 m_adaptive_buffer_duration = 0; // usecs
+	u64 m_adaptive_last_change = 0;
+	u64 m_adaptive_underruns = 0;
+
+	void update_adaptive_buffering(u64 timestamp);
+	u64 get_desired_buffer_duration() const;
+	u32 get_desired_full_buffers() const;
+
 public:
 	shared_mutex emu_cfg_upd_m{};
 	cell_audio_config cfg{};
@@ -407,6 +448,16 @@ public:
 	bool m_backend_failed = false;
 	bool m_audio_should_restart = false;
 
+	// Buffering telemetry for the performance overlay
+	struct buffer_stats
+	{
+		atomic_t<u32> enqueued_us = 0;
+		atomic_t<u32> target_us = 0;
+		atomic_t<u32> jitter_us = 0;
+		atomic_t<u64> underruns = 0;
+		atomic_t<u64> overruns = 0;
+	} m_buffer_stats{};
+
 	void operator()();
 
 	SAVESTATE_INIT_POS(9);
@@ -9,6 +9,25 @@
 
 #include "util/asm.hpp"
 
+#include <bit>
+
+#if defined(ARCH_X64)
+#include "emmintrin.h"
+#endif
+
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#endif
+
+#ifdef ARCH_ARM64
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif
+#undef FORCE_INLINE
+#include "Emu/CPU/sse2neon.h"
+#endif
+
 LOG_CHANNEL(cellDmux);
 
 template <>
@@ -45,6 +64,42 @@ enum
 	PRIVATE_STREAM_2         = 0x000001bf,
 };
 
+// Returns the offset of the first 00 00 01 start code prefix in data, or size if there is none
+static u32 find_start_code_prefix(const u8* data, u32 size)
+{
+	u32 i = 0;
+
+	// Compare 16 candidate positions at once, each needs the two following bytes as well
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i one = _mm_set1_epi8(1);
+
+	for (; i + 18 <= size; i += 16)
+	{
+		const __m128i b0 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), zero);
+		const __m128i b1 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 1)), zero);
+		const __m128i b2 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 2)), one);
+
+		if (const u32 mask = _mm_movemask_epi8(_mm_and_si128(_mm_and_si128(b0, b1), b2)))
+		{
+			return i + std::countr_zero(mask);
+		}
+	}
+
+	for (; i + 3 <= size; i++)
+	{
+		if (data[i] == 0 && data[i + 1] == 0 && data[i + 2] == 1)
+		{
+			return i;
+		}
+	}
+
+	return size;
+}
+
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic pop
+#endif
+
 struct DemuxerStream
 {
 	u32 addr;
@@ -84,6 +139,13 @@ struct DemuxerStream
 		return count <= size;
 	}
 
+	// Skips at least one byte and stops at the next start code prefix (or the end of the stream)
+	void skip_to_start_code()
+	{
+		skip(1);
+		skip(find_start_code_prefix(vm::_ptr<const u8>(addr), size));
+	}
+
 	u64 get_ts(u8 c)
 	{
 		u8 v[4]; get(v);
@@ -509,7 +571,7 @@ public:
 					}
 
 					// search
-					stream.skip(1);
+					stream.skip_to_start_code();
 				}
 				}
 
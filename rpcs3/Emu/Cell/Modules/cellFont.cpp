@@ -1,11 +1,15 @@
 #include "stdafx.h"
 #include "Emu/VFS.h"
+#include "Emu/IdManager.h"
 #include "Emu/Cell/PPUModule.h"
+#include "Emu/system_config.h"
 
 #include <stb_truetype.h>
 
 #include "cellFont.h"
 
+#include <list>
+
 LOG_CHANNEL(cellFont);
 
 template <>
@@ -46,6 +50,136 @@ void fmt_class_string<CellFontError>::format(std::string& out, u64 arg)
 	});
 }
 
+// LRU cache of rasterized glyphs, games tend to redraw the same strings every frame
+struct font_glyph_cache
+{
+	struct key_t
+	{
+		u32 font_addr;
+		u32 scale_bits;
+		u32 code;
+
+		bool operator==(const key_t&) const = default;
+	};
+
+	struct key_hash
+	{
+		usz operator()(const key_t& key) const
+		{
+			return std::hash<u64>()((u64{key.font_addr} << 32 | key.code) ^ (u64{key.scale_bits} * 0x9e3779b97f4a7c15));
+		}
+	};
+
+	struct glyph
+	{
+		key_t key;
+		s32 width = 0;
+		s32 height = 0;
+		s32 xoff = 0;
+		s32 yoff = 0;
+		std::vector<u8> bitmap;
+	};
+
+	// Rough bookkeeping cost of an entry on top of its bitmap
+	static constexpr usz entry_overhead = 96;
+
+	shared_mutex mutex;
+	std::list<glyph> lru; // Most recently used first
+	std::unordered_map<key_t, std::list<glyph>::iterator, key_hash> map;
+	usz used_bytes = 0;
+
+	u64 hits = 0;
+	u64 misses = 0;
+	u64 evictions = 0;
+
+	~font_glyph_cache()
+	{
+		if (hits || misses)
+		{
+			cellFont.notice("Glyph cache: %d hits, %d misses (%.1f%% hit rate), %d evictions, %d glyphs (%d KiB) cached",
+				hits, misses, hits * 100. / (hits + misses), evictions, map.size(), used_bytes / 1024);
+		}
+	}
+
+	// Returns the glyph bitmap, rasterizing it on a miss. The returned glyph is valid until the next call.
+	const glyph* get(const CellFont& font, u32 code)
+	{
+		const usz budget = usz{g_cfg.core.font_glyph_cache_size} * 1024 * 1024;
+		const f32 scale_y = font.scale_y;
+		const key_t key{font.fontdata_addr, std::bit_cast<u32>(scale_y), code};
+
+		if (budget)
+		{
+			if (const auto found = map.find(key); found != map.end())
+			{
+				hits++;
+				lru.splice(lru.begin(), lru, found->second);
+				return &*found->second;
+			}
+
+			misses++;
+		}
+
+		glyph result{key};
+
+		const float scale = stbtt_ScaleForPixelHeight(font.stbfont, scale_y);
+		unsigned char* box = stbtt_GetCodepointBitmap(font.stbfont, scale, scale, code, &result.width, &result.height, &result.xoff, &result.yoff);
+
+		if (box)
+		{
+			result.bitmap.assign(box, box + static_cast<usz>(result.width) * result.height);
+			stbtt_FreeBitmap(box, nullptr);
+		}
+
+		if (!budget)
+		{
+			// Keep a single uncached entry around for the caller
+			clear();
+		}
+
+		used_bytes += result.bitmap.size() + entry_overhead;
+		lru.push_front(std::move(result));
+		map.emplace(key, lru.begin());
+
+		// Evict from the back, never the glyph that was just added
+		while (used_bytes > budget && lru.size() > 1)
+		{
+			const glyph& last = lru.back();
+			used_bytes -= last.bitmap.size() + entry_overhead;
+			map.erase(last.key);
+			lru.pop_back();
+			evictions++;
+		}
+
+		return &lru.front();
+	}
+
+	// Drops all glyphs of a font whose data is being replaced
+	void invalidate(u32 font_addr)
+	{
+		for (auto it = lru.begin(); it != lru.end();)
+		{
+			if (it->key.font_addr == font_addr)
+			{
+				used_bytes -= it->bitmap.size() + entry_overhead;
+				map.erase(it->key);
+				it = lru.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	void clear()
+	{
+		lru.clear();
+		map.clear();
+		used_bytes = 0;
+	}
+};
+
 // Functions
 error_code cellFontInitializeWithRevision(u64 revisionFlags, vm::ptr<CellFontConfig> config)
 {
@@ -93,6 +227,13 @@ error_code cellFontOpenFontMemory(vm::ptr<CellFontLibrary> library, u32 fontAddr
 	if (!stbtt_InitFont(font->stbfont, vm::_ptr<unsigned char>(fontAddr), 0))
 		return CELL_FONT_ERROR_FONT_OPEN_FAILED;
 
+	{
+		// The address may have held another font before
+		auto& cache = g_fxo->get<font_glyph_cache>();
+		std::lock_guard lock(cache.mutex);
+		cache.invalidate(fontAddr);
+	}
+
 	font->renderer_addr = 0;
 	font->fontdata_addr = fontAddr;
 	font->origin = CELL_FONT_OPEN_MEMORY;
@@ -343,38 +484,47 @@ error_code cellFontRenderCharGlyphImage(vm::ptr<CellFont> font, u32 code, vm::pt
 		return CELL_FONT_ERROR_RENDERER_UNBIND;
 	}
 
+	auto& cache = g_fxo->get<font_glyph_cache>();
+	std::lock_guard lock(cache.mutex);
+
 	// Render the character
-	s32 width, height, xoff, yoff;
-	float scale = stbtt_ScaleForPixelHeight(font->stbfont, font->scale_y);
-	unsigned char* box = stbtt_GetCodepointBitmap(font->stbfont, scale, scale, code, &width, &height, &xoff, &yoff);
+	const auto glyph = cache.get(*font, code);
 
-	if (!box)
+	if (glyph->bitmap.empty())
 	{
 		return CELL_OK;
 	}
 
 	// Get the baseLineY value
 	s32 ascent, descent, lineGap;
+	const float scale = stbtt_ScaleForPixelHeight(font->stbfont, font->scale_y);
 	stbtt_GetFontVMetrics(font->stbfont, &ascent, &descent, &lineGap);
 	const s32 baseLineY = static_cast<int>(ascent * scale); // ???
 
-	// Move the rendered character to the surface
-	unsigned char* buffer = vm::_ptr<unsigned char>(surface->buffer.addr());
-	for (u32 ypos = 0; ypos < static_cast<u32>(height); ypos++)
+	// Clip the glyph against the surface once and move it row by row
+	// TODO: There are some oddities in the position of the character in the final buffer
+	const s32 surface_width = surface->width;
+	const s32 surface_height = surface->height;
+	const s32 dst_x = static_cast<s32>(x);
+	const s32 dst_y = static_cast<s32>(y) + glyph->yoff + baseLineY;
+
+	const s32 first_col = std::max(0, -dst_x);
+	const s32 last_col = std::min(glyph->width, surface_width - dst_x);
+	const s32 first_row = std::max(0, -dst_y);
+	const s32 last_row = std::min(glyph->height, surface_height - dst_y);
+
+	if (first_col >= last_col || first_row >= last_row)
 	{
-		if (static_cast<u32>(y) + ypos + yoff + baseLineY >= static_cast<u32>(surface->height))
-			break;
+		return CELL_OK;
+	}
 
-		for (u32 xpos = 0; xpos < static_cast<u32>(width); xpos++)
-		{
-			if (static_cast<u32>(x) + xpos >= static_cast<u32>(surface->width))
-				break;
+	unsigned char* buffer = vm::_ptr<unsigned char>(surface->buffer.addr());
 
-			// TODO: There are some oddities in the position of the character in the final buffer
-			buffer[(static_cast<s32>(y) + ypos + yoff + baseLineY) * surface->width + static_cast<s32>(x) + xpos] = box[ypos * width + xpos];
-		}
+	for (s32 ypos = first_row; ypos < last_row; ypos++)
+	{
+		std::memcpy(buffer + static_cast<usz>(dst_y + ypos) * surface_width + dst_x + first_col, glyph->bitmap.data() + static_cast<usz>(ypos) * glyph->width + first_col, last_col - first_col);
 	}
-	stbtt_FreeBitmap(box, nullptr);
+
 	return CELL_OK;
 }
 
@@ -419,6 +569,12 @@ error_code cellFontCloseFont(vm::ptr<CellFont> font)
 {
 	cellFont.warning("cellFontCloseFont(font=*0x%x)", font);
 
+	{
+		auto& cache = g_fxo->get<font_glyph_cache>();
+		std::lock_guard lock(cache.mutex);
+		cache.invalidate(font->fontdata_addr);
+	}
+
 	if (font->origin == CELL_FONT_OPEN_FONTSET ||
 		font->origin == CELL_FONT_OPEN_FONT_FILE ||
 		font->origin == CELL_FONT_OPEN_MEMORY)
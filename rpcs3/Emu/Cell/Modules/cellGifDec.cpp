@@ -10,6 +10,7 @@
 #include "cellGifDec.h"
 
 #include "util/asm.hpp"
+#include "util/image_scaler.hpp"
 
 LOG_CHANNEL(cellGifDec);
 
@@ -489,30 +490,36 @@ error_code cellGifDecDecodeData(vm::ptr<GifDecoder> mainHandle, vm::cptr<GifStre
 	const u64 fileSize = subHandle->fileSize;
 	const CellGifDecOutParam& current_outParam = subHandle->outParam;
 
-	//Copy the GIF file to a buffer
-	std::unique_ptr<u8[]> gif(new u8[fileSize]);
+	// Buffer sources are decoded straight from guest memory, only file sources need a copy
+	std::vector<u8> file_data;
+	const u8* gif = nullptr;
 
 	switch (subHandle->src.srcSelect)
 	{
 	case CELL_GIFDEC_BUFFER:
-		std::memcpy(gif.get(), subHandle->src.streamPtr.get_ptr(), fileSize);
+		gif = static_cast<const u8*>(subHandle->src.streamPtr.get_ptr());
 		break;
 
 	case CELL_GIFDEC_FILE:
 	{
 		auto file = idm::get<lv2_fs_object, lv2_file>(fd);
+		file_data.resize(fileSize);
 		file->file.seek(0);
-		file->file.read(gif.get(), fileSize);
+		file->file.read(file_data.data(), fileSize);
+		gif = file_data.data();
 		break;
 	}
 	default: break; // TODO
 	}
 
+	if (!gif)
+		return CELL_GIFDEC_ERROR_STREAM_FORMAT;
+
 	//Decode GIF file. (TODO: Is there any faster alternative? Can we do it without external libraries?)
 	int width, height, actual_components;
 	auto image = std::unique_ptr<unsigned char,decltype(&::free)>
 		(
-			stbi_load_from_memory(gif.get(), ::narrow<int>(fileSize), &width, &height, &actual_components, 4),
+			stbi_load_from_memory(gif, ::narrow<int>(fileSize), &width, &height, &actual_components, 4),
 			&::free
 		);
 
@@ -520,67 +527,21 @@ error_code cellGifDecDecodeData(vm::ptr<GifDecoder> mainHandle, vm::cptr<GifStre
 		return CELL_GIFDEC_ERROR_STREAM_FORMAT;
 
 	const int bytesPerLine = static_cast<int>(dataCtrlParam->outputBytesPerLine);
-	const char nComponents = 4;
-	uint image_size = width * height * nComponents;
+	const int nComponents = 4;
+
+	// Lines are stored with the requested pitch if it needs padding, packed otherwise
+	const bool padded = bytesPerLine > width * nComponents;
+	const int dst_pitch = padded ? bytesPerLine : width * nComponents;
 
 	switch(current_outParam.outputColorSpace)
 	{
 	case CELL_GIFDEC_RGBA:
-	{
-		if (bytesPerLine > width * nComponents) // Check if we need padding
-		{
-			const int linesize = std::min(bytesPerLine, width * nComponents);
-			for (int i = 0; i < height; i++)
-			{
-				const int dstOffset = i * bytesPerLine;
-				const int srcOffset = width * nComponents * i;
-				memcpy(&data[dstOffset], &image.get()[srcOffset], linesize);
-			}
-		}
-		else
-		{
-			memcpy(data.get_ptr(), image.get(), image_size);
-		}
-	}
-	break;
+		utils::convert_rgba32(data.get_ptr(), width, height, dst_pitch, image.get(), width, utils::rgba32_order::rgba, false);
+		break;
 
 	case CELL_GIFDEC_ARGB:
-	{
-		if (bytesPerLine > width * nComponents) // Check if we need padding
-		{
-			//TODO: find out if we can't do padding without an extra copy
-			const int linesize = std::min(bytesPerLine, width * nComponents);
-			const auto output = std::make_unique<char[]>(linesize);
-			for (int i = 0; i < height; i++)
-			{
-				const int dstOffset = i * bytesPerLine;
-				const int srcOffset = width * nComponents * i;
-				for (int j = 0; j < linesize; j += nComponents)
-				{
-					output[j + 0] = image.get()[srcOffset + j + 3];
-					output[j + 1] = image.get()[srcOffset + j + 0];
-					output[j + 2] = image.get()[srcOffset + j + 1];
-					output[j + 3] = image.get()[srcOffset + j + 2];
-				}
-				std::memcpy(&data[dstOffset], output.get(), linesize);
-			}
-		}
-		else
-		{
-			const auto img = std::make_unique<uint[]>(image_size);
-			uint* source_current = reinterpret_cast<uint*>(image.get());
-			uint* dest_current = img.get();
-			for (uint i = 0; i < image_size / nComponents; i++)
-			{
-				uint val = *source_current;
-				*dest_current = (val >> 24) | (val << 8); // set alpha (A8) as leftmost byte
-				source_current++;
-				dest_current++;
-			}
-			std::memcpy(data.get_ptr(), img.get(), image_size);
-		}
-	}
-	break;
+		utils::convert_rgba32(data.get_ptr(), width, height, dst_pitch, image.get(), width, utils::rgba32_order::argb, false);
+		break;
 
 	default:
 		return CELL_GIFDEC_ERROR_ARG;
@@ -10,6 +10,7 @@
 #include "cellJpgDec.h"
 
 #include "util/asm.hpp"
+#include "util/image_scaler.hpp"
 
 LOG_CHANNEL(cellJpgDec);
 
@@ -212,30 +213,36 @@ error_code cellJpgDecDecodeData(u32 mainHandle, u32 subHandle, vm::ptr<u8> data,
 	const u64& fileSize = subHandle_data->fileSize;
 	const CellJpgDecOutParam& current_outParam = subHandle_data->outParam;
 
-	//Copy the JPG file to a buffer
-	std::unique_ptr<u8[]> jpg(new u8[fileSize]);
+	// Buffer sources are decoded straight from guest memory, only file sources need a copy
+	std::vector<u8> file_data;
+	const u8* jpg = nullptr;
 
 	switch (subHandle_data->src.srcSelect)
 	{
 	case CELL_JPGDEC_BUFFER:
-		std::memcpy(jpg.get(), vm::base(subHandle_data->src.streamPtr), fileSize);
+		jpg = vm::_ptr<const u8>(subHandle_data->src.streamPtr);
 		break;
 
 	case CELL_JPGDEC_FILE:
 	{
 		auto file = idm::get<lv2_fs_object, lv2_file>(fd);
+		file_data.resize(fileSize);
 		file->file.seek(0);
-		file->file.read(jpg.get(), fileSize);
+		file->file.read(file_data.data(), fileSize);
+		jpg = file_data.data();
 		break;
 	}
 	default: break; // TODO
 	}
 
+	if (!jpg)
+		return CELL_JPGDEC_ERROR_STREAM_FORMAT;
+
 	//Decode JPG file. (TODO: Is there any faster alternative? Can we do it without external libraries?)
 	int width, height, actual_components;
 	auto image = std::unique_ptr<unsigned char,decltype(&::free)>
 		(
-			stbi_load_from_memory(jpg.get(), ::narrow<int>(fileSize), &width, &height, &actual_components, 4),
+			stbi_load_from_memory(jpg, ::narrow<int>(fileSize), &width, &height, &actual_components, 4),
 			&::free
 		);
 
@@ -250,62 +257,24 @@ error_code cellJpgDecDecodeData(u32 mainHandle, u32 subHandle, vm::ptr<u8> data,
 	{
 	case CELL_JPG_RGB:
 	case CELL_JPG_RGBA:
-	{
-		const char nComponents = current_outParam.outputColorSpace == CELL_JPG_RGBA ? 4 : 3;
-		image_size *= nComponents;
-		if (bytesPerLine > width * nComponents || flip) //check if we need padding
-		{
-			const int linesize = std::min(bytesPerLine, width * nComponents);
-			for (int i = 0; i < height; i++)
-			{
-				const int dstOffset = i * bytesPerLine;
-				const int srcOffset = width * nComponents * (flip ? height - i - 1 : i);
-				memcpy(&data[dstOffset], &image.get()[srcOffset], linesize);
-			}
-		}
-		else
-		{
-			memcpy(data.get_ptr(), image.get(), image_size);
-		}
-	}
-	break;
-
 	case CELL_JPG_ARGB:
 	{
-		const int nComponents = 4;
+		const int nComponents = current_outParam.outputColorSpace == CELL_JPG_RGB ? 3 : 4;
 		image_size *= nComponents;
-		if (bytesPerLine > width * nComponents || flip) //check if we need padding
+
+		// Lines are stored with the requested pitch if it needs padding or the image is flipped, packed otherwise
+		const bool padded = bytesPerLine > width * nComponents || flip;
+		const int dst_pitch = padded ? bytesPerLine : width * nComponents;
+		const int dst_width = padded ? std::min(bytesPerLine, width * nComponents) / nComponents : width;
+
+		if (nComponents == 3)
 		{
-			//TODO: Find out if we can't do padding without an extra copy
-			const int linesize = std::min(bytesPerLine, width * nComponents);
-			const auto output = std::make_unique<char[]>(linesize);
-			for (int i = 0; i < height; i++)
-			{
-				const int dstOffset = i * bytesPerLine;
-				const int srcOffset = width * nComponents * (flip ? height - i - 1 : i);
-				for (int j = 0; j < linesize; j += nComponents)
-				{
-					output[j + 0] = image.get()[srcOffset + j + 3];
-					output[j + 1] = image.get()[srcOffset + j + 0];
-					output[j + 2] = image.get()[srcOffset + j + 1];
-					output[j + 3] = image.get()[srcOffset + j + 2];
-				}
-				std::memcpy(&data[dstOffset], output.get(), linesize);
-			}
+			utils::convert_rgba32_to_rgb24(data.get_ptr(), dst_width, height, dst_pitch, image.get(), width, flip);
 		}
 		else
 		{
-			const auto img = std::make_unique<uint[]>(image_size);
-			uint* source_current = reinterpret_cast<uint*>(image.get());
-			uint* dest_current = img.get();
-			for (uint i = 0; i < image_size / nComponents; i++)
-			{
-				uint val = *source_current;
-				*dest_current = (val >> 24) | (val << 8); // set alpha (A8) as leftmost byte
-				source_current++;
-				dest_current++;
-			}
-			std::memcpy(data.get_ptr(), img.get(), image_size);
+			const auto order = current_outParam.outputColorSpace == CELL_JPG_ARGB ? utils::rgba32_order::argb : utils::rgba32_order::rgba;
+			utils::convert_rgba32(data.get_ptr(), dst_width, height, dst_pitch, image.get(), width, order, flip);
 		}
 	}
 	break;
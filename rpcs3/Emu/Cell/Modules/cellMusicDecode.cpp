@@ -186,6 +186,8 @@ error_code cell_music_decode_read(vm::ptr<void> buf, vm::ptr<u32> startTime, u64
 		return CELL_MUSIC_DECODE_ERROR_DECODE_FAILURE;
 	}
 
+	dec.decoder.update_read_stats(dec.read_pos);
+
 	if (dec.decoder.m_size == 0)
 	{
 		return CELL_MUSIC_DECODE_ERROR_NO_LPCM_DATA;
@@ -1,4 +1,5 @@
 #include "stdafx.h"
+#include "Emu/System.h"
 #include "Emu/VFS.h"
 #include "Emu/IdManager.h"
 #include "Emu/Cell/PPUModule.h"
@@ -9,6 +10,8 @@
 #include "cellSearch.h"
 #include "Utilities/StrUtil.h"
 #include "util/media_utils.h"
+#include "util/sysinfo.hpp"
+#include "util/yaml.hpp"
 
 #include <random>
 
@@ -111,6 +114,296 @@ struct search_object_t
 	std::vector<content_id_type> content_ids;
 };
 
+// Probe results of the media files, kept in the cache directory across sessions.
+// Entries are keyed by host path and are only reused if the size and modification time of the file still match.
+struct search_media_index
+{
+	static constexpr u32 version = 1;
+
+	struct entry
+	{
+		s32 av_media_type = 0;
+		u64 size = 0;
+		s64 mtime = 0;
+		bool success = false;
+		utils::media_info info{};
+	};
+
+	shared_mutex mutex;
+	std::unordered_map<std::string, entry> entries;
+	bool loaded = false;
+	bool dirty = false;
+
+	static std::string get_path()
+	{
+		return fs::get_cache_dir() + "cache/media_index.yml";
+	}
+
+	bool is_valid(const entry& e, const fs::dir_entry& item, s32 av_media_type) const
+	{
+		return e.av_media_type == av_media_type && e.size == item.size && e.mtime == item.mtime;
+	}
+
+	void load()
+	{
+		if (loaded)
+		{
+			return;
+		}
+
+		loaded = true;
+
+		const std::string path = get_path();
+		const fs::file file{path};
+
+		if (!file)
+		{
+			return;
+		}
+
+		auto [root, error] = yaml_load(file.to_string());
+
+		if (!error.empty() || !root)
+		{
+			cellSearch.error("Failed to load media index %s:\n%s", path, error);
+			return;
+		}
+
+		std::string err;
+
+		if (get_yaml_node_value<u32>(root["Version"], err) != version || !err.empty())
+		{
+			cellSearch.notice("Discarding media index %s (version mismatch)", path);
+			return;
+		}
+
+		for (const auto& node : root["Entries"])
+		{
+			const std::string file_path = node.first.Scalar();
+			const YAML::Node& value = node.second;
+
+			entry e{};
+			e.av_media_type = get_yaml_node_value<s32>(value["Type"], err);
+			e.size = get_yaml_node_value<u64>(value["Size"], err);
+			e.mtime = get_yaml_node_value<s64>(value["MTime"], err);
+			e.success = get_yaml_node_value<bool>(value["Success"], err);
+
+			utils::media_info& mi = e.info;
+			mi.path = file_path;
+			mi.sub_type = get_yaml_node_value<std::string>(value["SubType"], err);
+			mi.audio_av_codec_id = get_yaml_node_value<s32>(value["AudioCodec"], err);
+			mi.video_av_codec_id = get_yaml_node_value<s32>(value["VideoCodec"], err);
+			mi.audio_bitrate_bps = get_yaml_node_value<s32>(value["AudioBitrate"], err);
+			mi.video_bitrate_bps = get_yaml_node_value<s32>(value["VideoBitrate"], err);
+			mi.sample_rate = get_yaml_node_value<s32>(value["SampleRate"], err);
+			mi.duration_us = get_yaml_node_value<s64>(value["Duration"], err);
+			mi.width = get_yaml_node_value<s32>(value["Width"], err);
+			mi.height = get_yaml_node_value<s32>(value["Height"], err);
+			mi.orientation = get_yaml_node_value<s32>(value["Orientation"], err);
+
+			for (const auto& tag : value["Metadata"])
+			{
+				mi.metadata.emplace(tag.first.Scalar(), tag.second.Scalar());
+			}
+
+			if (!err.empty())
+			{
+				cellSearch.error("Discarding media index %s (bad entry for %s: %s)", path, file_path, err);
+				entries.clear();
+				return;
+			}
+
+			// Drop entries of files that have been removed
+			if (fs::is_file(file_path))
+			{
+				entries.emplace(file_path, std::move(e));
+			}
+			else
+			{
+				dirty = true;
+			}
+		}
+
+		cellSearch.notice("Loaded %d entries from media index %s", entries.size(), path);
+	}
+
+	void save()
+	{
+		if (!dirty)
+		{
+			return;
+		}
+
+		dirty = false;
+
+		YAML::Emitter out;
+		out << YAML::BeginMap;
+		out << "Version" << version;
+		out << "Entries" << YAML::BeginMap;
+
+		for (const auto& [file_path, e] : entries)
+		{
+			const utils::media_info& mi = e.info;
+
+			out << file_path << YAML::BeginMap;
+			out << "Type" << e.av_media_type;
+			out << "Size" << e.size;
+			out << "MTime" << e.mtime;
+			out << "Success" << e.success;
+			out << "SubType" << mi.sub_type;
+			out << "AudioCodec" << mi.audio_av_codec_id;
+			out << "VideoCodec" << mi.video_av_codec_id;
+			out << "AudioBitrate" << mi.audio_bitrate_bps;
+			out << "VideoBitrate" << mi.video_bitrate_bps;
+			out << "SampleRate" << mi.sample_rate;
+			out << "Duration" << mi.duration_us;
+			out << "Width" << mi.width;
+			out << "Height" << mi.height;
+			out << "Orientation" << mi.orientation;
+			out << "Metadata" << YAML::BeginMap;
+
+			for (const auto& [key, value] : mi.metadata)
+			{
+				out << key << value;
+			}
+
+			out << YAML::EndMap;
+			out << YAML::EndMap;
+		}
+
+		out << YAML::EndMap;
+		out << YAML::EndMap;
+
+		const std::string path = get_path();
+
+		if (!fs::create_path(fs::get_parent_dir(path)))
+		{
+			cellSearch.error("Failed to create media index directory for %s (%s)", path, fs::g_tls_error);
+			return;
+		}
+
+		fs::pending_file file(path);
+
+		if (!file.file || (file.file.write(out.c_str(), out.size()), !file.commit()))
+		{
+			cellSearch.error("Failed to save media index %s (%s)", path, fs::g_tls_error);
+		}
+	}
+
+	// Probes the files of a directory that are missing from the index or outdated, spread over a few threads
+	void update(const std::string& host_dir, const std::vector<fs::dir_entry>& items, s32 av_media_type)
+	{
+		std::lock_guard lock(mutex);
+
+		load();
+
+		std::vector<std::pair<std::string, const fs::dir_entry*>> queue;
+
+		for (const fs::dir_entry& item : items)
+		{
+			if (item.is_directory)
+			{
+				continue;
+			}
+
+			std::string file_path = host_dir + "/" + item.name;
+
+			if (const auto found = entries.find(file_path); found == entries.end() || !is_valid(found->second, item, av_media_type))
+			{
+				queue.emplace_back(std::move(file_path), &item);
+			}
+		}
+
+		if (queue.empty())
+		{
+			return;
+		}
+
+		std::vector<entry> results(queue.size());
+		atomic_t<usz> next = 0;
+
+		const auto probe = [&]()
+		{
+			for (usz i = next++; i < queue.size(); i = next++)
+			{
+				if (Emu.IsStopped())
+				{
+					continue;
+				}
+
+				const auto& [file_path, item] = queue[i];
+
+				entry& e = results[i];
+				e.av_media_type = av_media_type;
+				e.size = item->size;
+				e.mtime = item->mtime;
+				std::tie(e.success, e.info) = utils::get_media_info(file_path, av_media_type);
+			}
+		};
+
+		// Probing is mostly spent waiting on the disk and in the demuxer, so a handful of threads is enough
+		const u32 thread_count = std::min<u32>({utils::get_thread_count(), ::size32(queue), 8});
+
+		if (thread_count > 1)
+		{
+			named_thread_group workers("Media Probe ", thread_count, probe);
+		}
+		else
+		{
+			probe();
+		}
+
+		if (Emu.IsStopped())
+		{
+			// Don't remember files that were skipped
+			return;
+		}
+
+		for (usz i = 0; i < queue.size(); i++)
+		{
+			entries.insert_or_assign(std::move(queue[i].first), std::move(results[i]));
+		}
+
+		dirty = true;
+
+		cellSearch.notice("Probed %d media files in %s", queue.size(), host_dir);
+	}
+
+	// Returns the probe result of a file, probing it if it has not been indexed yet
+	std::pair<bool, utils::media_info> get(const std::string& host_dir, const fs::dir_entry& item, s32 av_media_type)
+	{
+		const std::string file_path = host_dir + "/" + item.name;
+
+		{
+			std::lock_guard lock(mutex);
+
+			load();
+
+			if (const auto found = entries.find(file_path); found != entries.end() && is_valid(found->second, item, av_media_type))
+			{
+				return { found->second.success, found->second.info };
+			}
+		}
+
+		update(host_dir, { item }, av_media_type);
+
+		std::lock_guard lock(mutex);
+
+		if (const auto found = entries.find(file_path); found != entries.end())
+		{
+			return { found->second.success, found->second.info };
+		}
+
+		return { false, {} };
+	}
+
+	void flush()
+	{
+		std::lock_guard lock(mutex);
+		save();
+	}
+};
+
 error_code check_search_state(search_state state, search_state action)
 {
 	switch (action)
@@ -791,7 +1084,7 @@ error_code cellSearchStartContentSearchInList(vm::cptr<CellSearchContentId> list
 
 	const u32 id = *outSearchId = idm::make<search_object_t>();
 
-	sysutil_register_cb([=, list_path = std::string(content_info->infoPath.contentPath), &search, &content_map](ppu_thread& ppu) -> s32
+	sysutil_register_cb([=, list_path = std::string(content_info->infoPath.contentPath), &search, &content_map, &media_index = g_fxo->get<search_media_index>()](ppu_thread& ppu) -> s32
 	{
 		auto curr_search = idm::get<search_object_t>(id);
 		vm::var<CellSearchResultParam> resultParam;
@@ -835,6 +1128,13 @@ error_code cellSearchStartContentSearchInList(vm::cptr<CellSearchContentId> list
 
 			// TODO: Use sortKey (CellSearchSortKey) to allow for sorting by category
 
+			const std::string host_dir = vfs::get(vpath);
+
+			if (type == CELL_SEARCH_CONTENTSEARCHTYPE_MUSIC_ALL || type == CELL_SEARCH_CONTENTSEARCHTYPE_VIDEO_ALL)
+			{
+				media_index.update(host_dir, files_sorted, type == CELL_SEARCH_CONTENTSEARCHTYPE_MUSIC_ALL ? 1 : 0);
+			}
+
 			for (auto&& item : files_sorted)
 			{
 				// TODO
@@ -872,8 +1172,7 @@ error_code cellSearchStartContentSearchInList(vm::cptr<CellSearchContentId> list
 					{
 						curr_find->type = CELL_SEARCH_CONTENTTYPE_MUSIC;
 
-						const std::string path = vfs::get(vpath) + "/" + item.name;
-						const auto [success, mi] = utils::get_media_info(path, 1); // AVMEDIA_TYPE_AUDIO
+						const auto [success, mi] = media_index.get(host_dir, item, 1); // AVMEDIA_TYPE_AUDIO
 						if (!success)
 						{
 							continue;
@@ -893,8 +1192,7 @@ error_code cellSearchStartContentSearchInList(vm::cptr<CellSearchContentId> list
 					{
 						curr_find->type = CELL_SEARCH_CONTENTTYPE_VIDEO;
 
-						const std::string path = vfs::get(vpath) + "/" + item.name;
-						const auto [success, mi] = utils::get_media_info(path, 0); // AVMEDIA_TYPE_VIDEO
+						const auto [success, mi] = media_index.get(host_dir, item, 0); // AVMEDIA_TYPE_VIDEO
 						if (!success)
 						{
 							continue;
@@ -930,6 +1228,7 @@ error_code cellSearchStartContentSearchInList(vm::cptr<CellSearchContentId> list
 		};
 
 		searchInFolder(list_path);
+		media_index.flush();
 		resultParam->resultNum = ::narrow<s32>(curr_search->content_ids.size());
 
 		search.state.store(search_state::idle);
@@ -1051,7 +1350,7 @@ error_code cellSearchStartContentSearch(CellSearchContentSearchType type, CellSe
 
 	const u32 id = *outSearchId = idm::make<search_object_t>();
 
-	sysutil_register_cb([=, &content_map = g_fxo->get<content_id_map>(), &search](ppu_thread& ppu) -> s32
+	sysutil_register_cb([=, &content_map = g_fxo->get<content_id_map>(), &media_index = g_fxo->get<search_media_index>(), &search](ppu_thread& ppu) -> s32
 	{
 		auto curr_search = idm::get<search_object_t>(id);
 		vm::var<CellSearchResultParam> resultParam;
@@ -1061,8 +1360,11 @@ error_code cellSearchStartContentSearch(CellSearchContentSearchType type, CellSe
 		std::function<void(const std::string&, const std::string&)> searchInFolder = [&, type](const std::string& vpath, const std::string& prev)
 		{
 			const std::string relative_vpath = (!prev.empty() ? prev + "/" : "") + vpath;
+			const std::string host_dir = vfs::get(relative_vpath);
+
+			std::vector<fs::dir_entry> items;
 
-			for (auto&& item : fs::dir(vfs::get(relative_vpath)))
+			for (auto&& item : fs::dir(host_dir))
 			{
 				item.name = vfs::unescape(item.name);
 
@@ -1071,6 +1373,16 @@ error_code cellSearchStartContentSearch(CellSearchContentSearchType type, CellSe
 					continue;
 				}
 
+				items.push_back(std::move(item));
+			}
+
+			if (type == CELL_SEARCH_CONTENTSEARCHTYPE_MUSIC_ALL || type == CELL_SEARCH_CONTENTSEARCHTYPE_VIDEO_ALL)
+			{
+				media_index.update(host_dir, items, type == CELL_SEARCH_CONTENTSEARCHTYPE_MUSIC_ALL ? 1 : 0);
+			}
+
+			for (auto&& item : items)
+			{
 				if (item.is_directory)
 				{
 					searchInFolder(item.name, relative_vpath);
@@ -1113,8 +1425,7 @@ error_code cellSearchStartContentSearch(CellSearchContentSearchType type, CellSe
 					{
 						curr_find->type = CELL_SEARCH_CONTENTTYPE_MUSIC;
 
-						const std::string path = vfs::get(vpath) + "/" + item.name;
-						const auto [success, mi] = utils::get_media_info(path, 1); // AVMEDIA_TYPE_AUDIO
+						const auto [success, mi] = media_index.get(host_dir, item, 1); // AVMEDIA_TYPE_AUDIO
 						if (!success)
 						{
 							continue;
@@ -1134,8 +1445,7 @@ error_code cellSearchStartContentSearch(CellSearchContentSearchType type, CellSe
 					{
 						curr_find->type = CELL_SEARCH_CONTENTTYPE_VIDEO;
 
-						const std::string path = vfs::get(vpath) + "/" + item.name;
-						const auto [success, mi] = utils::get_media_info(path, 0); // AVMEDIA_TYPE_VIDEO
+						const auto [success, mi] = media_index.get(host_dir, item, 0); // AVMEDIA_TYPE_VIDEO
 						if (!success)
 						{
 							continue;
@@ -1171,6 +1481,7 @@ error_code cellSearchStartContentSearch(CellSearchContentSearchType type, CellSe
 		};
 
 		searchInFolder(fmt::format("/dev_hdd0/%s", media_dir), "");
+		media_index.flush();
 		resultParam->resultNum = ::narrow<s32>(curr_search->content_ids.size());
 
 		search.state.store(search_state::idle);
@@ -2230,7 +2541,7 @@ error_code music_selection_context::find_content_id(vm::ptr<CellSearchContentId>
 
 			if (hash == file_hash)
 			{
-				const auto [success, mi] = utils::get_media_info(vfs_dir_path + "/" + item.name, 1); // AVMEDIA_TYPE_AUDIO
+				const auto [success, mi] = g_fxo->get<search_media_index>().get(vfs_dir_path, item, 1); // AVMEDIA_TYPE_AUDIO
 				if (!success)
 				{
 					continue;
@@ -8,6 +8,8 @@
 #include "sysPrxForUser.h"
 #include "util/media_utils.h"
 #include "util/init_mutex.hpp"
+#include "util/sysinfo.hpp"
+#include "Emu/system_config.h"
 
 #ifdef _MSC_VER
 #pragma warning(push, 0)
@@ -34,10 +36,12 @@ extern "C"
 
 #include <mutex>
 #include <queue>
+#include <map>
 #include <cmath>
 #include "Utilities/lockless.h"
 #include <variant>
 #include "util/asm.hpp"
+#include "util/image_scaler.hpp"
 
 std::mutex g_mutex_avcodec_open2;
 
@@ -207,6 +211,16 @@ struct vdec_context final
 
 	atomic_t<u32> au_count{0};
 
+	// Per-AU data carried through the decoder, pictures may come out several AUs later
+	struct au_info_t
+	{
+		u64 userdata;
+		CellVdecPicAttr attr;
+	};
+
+	u64 next_au_tag{};
+	std::map<u64, au_info_t> au_info;
+
 	lf_queue<vdec_cmd> in_cmd;
 
 	AVRational log_time_base{}; // Used to reduce log spam
@@ -253,6 +267,15 @@ struct vdec_context final
 			fmt::throw_exception("avcodec_alloc_context3() failed (type=0x%x)", type);
 		}
 
+		// Frame threading holds back one picture per extra thread, so it is only used when a thread count is set explicitly
+		// Held back pictures are drained at the end of each sequence
+		const u32 thread_count = g_cfg.video.vdec_thread_count ? g_cfg.video.vdec_thread_count : std::clamp<u32>(utils::get_thread_count() / 2, 1, 8);
+		ctx->thread_count = thread_count;
+		ctx->thread_type = g_cfg.video.vdec_thread_count ? FF_THREAD_FRAME | FF_THREAD_SLICE : FF_THREAD_SLICE;
+#ifdef AV_CODEC_FLAG_COPY_OPAQUE
+		ctx->flags |= AV_CODEC_FLAG_COPY_OPAQUE;
+#endif
+
 		AVDictionary* opts = nullptr;
 
 		std::lock_guard lock(g_mutex_avcodec_open2);
@@ -275,6 +298,8 @@ struct vdec_context final
 
 		av_dict_free(&opts);
 
+		cellVdec.notice("Created video decoder (type=0x%x, threads=%d)", type, thread_count);
+
 		seq_state = sequence_state::dormant;
 	}
 
@@ -285,6 +310,200 @@ struct vdec_context final
 		sws_freeContext(sws);
 	}
 
+	// Collects every picture the decoder has ready
+	void receive_frames(const vdec_cmd& cmd, std::deque<vdec_frame>& decoded_frames)
+	{
+		while (!abort_decode && seq_id == cmd.seq_id)
+		{
+			// Keep receiving frames
+			vdec_frame frame;
+			frame.seq_id = cmd.seq_id;
+			frame.cmd_id = cmd.id;
+			frame.avf.reset(av_frame_alloc());
+
+			if (!frame.avf)
+			{
+				fmt::throw_exception("av_frame_alloc() failed (handle=0x%x, seq_id=%d, cmd_id=%d)", handle, cmd.seq_id, cmd.id);
+			}
+
+			if (int ret = avcodec_receive_frame(ctx, frame.avf.get()); ret < 0)
+			{
+				if (ret == AVERROR(EAGAIN) || ret == AVERROR(EOF))
+				{
+					break;
+				}
+
+				fmt::throw_exception("AU decoding error (handle=0x%x, seq_id=%d, cmd_id=%d, error=0x%x): %s", handle, cmd.seq_id, cmd.id, ret, utils::av_error_to_string(ret));
+			}
+
+			if (frame->interlaced_frame)
+			{
+				// NPEB01838, NPUB31260
+				cellVdec.todo("Interlaced frames not supported (handle=0x%x, seq_id=%d, cmd_id=%d, interlaced_frame=0x%x)", handle, cmd.seq_id, cmd.id, frame->interlaced_frame);
+			}
+
+			if (frame->repeat_pict)
+			{
+				fmt::throw_exception("Repeated frames not supported (handle=0x%x, seq_id=%d, cmd_id=%d, repear_pict=0x%x)", handle, cmd.seq_id, cmd.id, frame->repeat_pict);
+			}
+
+			if (frame->pts != smin)
+			{
+				next_pts = frame->pts;
+			}
+
+			if (frame->pkt_dts != smin)
+			{
+				next_dts = frame->pkt_dts;
+			}
+
+			frame.pts = next_pts;
+			frame.dts = next_dts;
+
+#ifdef AV_CODEC_FLAG_COPY_OPAQUE
+			const u64 au_tag = reinterpret_cast<uptr>(frame->opaque);
+#else
+			const u64 au_tag = frame->reordered_opaque;
+#endif
+
+			if (const auto found = au_info.find(au_tag); found != au_info.end())
+			{
+				frame.userdata = found->second.userdata;
+				frame.attr = found->second.attr;
+				au_info.erase(found);
+			}
+			else
+			{
+				cellVdec.error("Picture without AU info (handle=0x%x, seq_id=%d, cmd_id=%d, tag=0x%llx)", handle, cmd.seq_id, cmd.id, au_tag);
+			}
+
+			if (frc_set)
+			{
+				u64 amend = 0;
+
+				switch (frc_set)
+				{
+				case CELL_VDEC_FRC_24000DIV1001: amend = 1001 * 90000 / 24000; break;
+				case CELL_VDEC_FRC_24: amend = 90000 / 24; break;
+				case CELL_VDEC_FRC_25: amend = 90000 / 25; break;
+				case CELL_VDEC_FRC_30000DIV1001: amend = 1001 * 90000 / 30000; break;
+				case CELL_VDEC_FRC_30: amend = 90000 / 30; break;
+				case CELL_VDEC_FRC_50: amend = 90000 / 50; break;
+				case CELL_VDEC_FRC_60000DIV1001: amend = 1001 * 90000 / 60000; break;
+				case CELL_VDEC_FRC_60: amend = 90000 / 60; break;
+				default:
+				{
+					fmt::throw_exception("Invalid frame rate code set (handle=0x%x, seq_id=%d, cmd_id=%d, frc=0x%x)", handle, cmd.seq_id, cmd.id, frc_set);
+				}
+				}
+
+				next_pts += amend;
+				next_dts += amend;
+				frame.frc = frc_set;
+			}
+			else if (ctx->time_base.num == 0)
+			{
+				if (log_time_base.den != ctx->time_base.den || log_time_base.num != ctx->time_base.num)
+				{
+					cellVdec.error("time_base.num is 0 (handle=0x%x, seq_id=%d, cmd_id=%d, %d/%d, tpf=%d framerate=%d/%d)", handle, cmd.seq_id, cmd.id, ctx->time_base.num, ctx->time_base.den, ctx->ticks_per_frame, ctx->framerate.num, ctx->framerate.den);
+					log_time_base = ctx->time_base;
+				}
+
+				// Hack
+				const u64 amend = u64{90000} / 30;
+				frame.frc = CELL_VDEC_FRC_30;
+				next_pts += amend;
+				next_dts += amend;
+			}
+			else
+			{
+				u64 amend = u64{90000} * ctx->time_base.num * ctx->ticks_per_frame / ctx->time_base.den;
+				const auto freq = 1. * ctx->time_base.den / ctx->time_base.num / ctx->ticks_per_frame;
+
+				if (std::abs(freq - 23.976) < 0.002)
+					frame.frc = CELL_VDEC_FRC_24000DIV1001;
+				else if (std::abs(freq - 24.000) < 0.001)
+					frame.frc = CELL_VDEC_FRC_24;
+				else if (std::abs(freq - 25.000) < 0.001)
+					frame.frc = CELL_VDEC_FRC_25;
+				else if (std::abs(freq - 29.970) < 0.002)
+					frame.frc = CELL_VDEC_FRC_30000DIV1001;
+				else if (std::abs(freq - 30.000) < 0.001)
+					frame.frc = CELL_VDEC_FRC_30;
+				else if (std::abs(freq - 50.000) < 0.001)
+					frame.frc = CELL_VDEC_FRC_50;
+				else if (std::abs(freq - 59.940) < 0.002)
+					frame.frc = CELL_VDEC_FRC_60000DIV1001;
+				else if (std::abs(freq - 60.000) < 0.001)
+					frame.frc = CELL_VDEC_FRC_60;
+				else
+				{
+					if (log_time_base.den != ctx->time_base.den || log_time_base.num != ctx->time_base.num)
+					{
+						// 1/1000 usually means that the time stamps are written in 1ms units and that the frame rate may vary.
+						cellVdec.error("Unsupported time_base (handle=0x%x, seq_id=%d, cmd_id=%d, %d/%d, tpf=%d framerate=%d/%d)", handle, cmd.seq_id, cmd.id, ctx->time_base.num, ctx->time_base.den, ctx->ticks_per_frame, ctx->framerate.num, ctx->framerate.den);
+						log_time_base = ctx->time_base;
+					}
+
+					// Hack
+					amend = u64{90000} / 30;
+					frame.frc = CELL_VDEC_FRC_30;
+				}
+
+				next_pts += amend;
+				next_dts += amend;
+			}
+
+			cellVdec.trace("Got picture (handle=0x%x, seq_id=%d, cmd_id=%d, pts=0x%llx[0x%llx], dts=0x%llx[0x%llx])", handle, cmd.seq_id, cmd.id, frame.pts, frame->pts, frame.dts, frame->pkt_dts);
+
+			decoded_frames.push_back(std::move(frame));
+		}
+	}
+
+	// Moves decoded pictures to the output queue, waiting for the game to make room
+	void output_frames(ppu_thread& ppu, u32 vid, const vdec_cmd& cmd, std::deque<vdec_frame>& decoded_frames)
+	{
+		while (!decoded_frames.empty() && seq_id == cmd.seq_id)
+		{
+			// Wait until there is free space in the image queue.
+			// Do this after pushing the frame to the queue. That way the game can consume the frame and we can move on.
+			u32 elapsed = 0;
+			while (thread_ctrl::state() != thread_state::aborting && !abort_decode && seq_id == cmd.seq_id)
+			{
+				{
+					std::lock_guard lock{mutex};
+
+					if (out_queue.size() <= out_max)
+					{
+						break;
+					}
+				}
+				thread_ctrl::wait_for(1000);
+
+				if (elapsed++ >= 5000) // 5 seconds
+				{
+					cellVdec.error("Video au decode has been waiting for a consumer for 5 seconds. (handle=0x%x, seq_id=%d, cmd_id=%d, queue_size=%d)", handle, cmd.seq_id, cmd.id, out_queue.size());
+					elapsed = 0;
+				}
+			}
+
+			if (thread_ctrl::state() == thread_state::aborting || abort_decode || seq_id != cmd.seq_id)
+			{
+				break;
+			}
+
+			{
+				std::lock_guard lock{mutex};
+				out_queue.push_back(std::move(decoded_frames.front()));
+				decoded_frames.pop_front();
+			}
+
+			cellVdec.trace("Sending CELL_VDEC_MSG_TYPE_PICOUT (handle=0x%x, seq_id=%d, cmd_id=%d)", handle, cmd.seq_id, cmd.id);
+			cb_func(ppu, vid, CELL_VDEC_MSG_TYPE_PICOUT, CELL_OK, cb_arg);
+			lv2_obj::sleep(ppu);
+		}
+	}
+
 	void exec(ppu_thread& ppu, u32 vid)
 	{
 		perf_meter<"VDEC"_u32> perf0;
@@ -335,6 +554,7 @@ struct vdec_context final
 				out_queue.clear(); // Flush image queue
 				log_time_base = {};
 				au_count = 0;
+				au_info.clear();
 
 				frc_set = 0; // TODO: ???
 				next_pts = 0;
@@ -348,6 +568,23 @@ struct vdec_context final
 			{
 				cellVdec.trace("End sequence... (handle=0x%x, seq_id=%d, cmd_id=%d)", handle, cmd->seq_id, cmd->id);
 
+				if (!abort_decode && seq_id == cmd->seq_id)
+				{
+					// Flush the pictures still held by the decoder (frame threading and reordering delay)
+					if (int ret = avcodec_send_packet(ctx, nullptr); ret < 0 && ret != AVERROR_EOF)
+					{
+						fmt::throw_exception("AU draining error (handle=0x%x, seq_id=%d, cmd_id=%d, error=0x%x): %s", handle, cmd->seq_id, cmd->id, ret, utils::av_error_to_string(ret));
+					}
+
+					std::deque<vdec_frame> decoded_frames;
+					receive_frames(*cmd, decoded_frames);
+					output_frames(ppu, vid, *cmd, decoded_frames);
+
+					// The decoder does not accept new packets after draining
+					avcodec_flush_buffers(ctx);
+					au_info.clear();
+				}
+
 				{
 					std::lock_guard lock{mutex};
 					seq_state = sequence_state::dormant;
@@ -389,6 +626,22 @@ struct vdec_context final
 
 				const CellVdecPicAttr attr = au_mode == CELL_VDEC_DEC_MODE_NORMAL ? CELL_VDEC_PICITEM_ATTR_NORMAL : CELL_VDEC_PICITEM_ATTR_SKIPPED;
 
+				// Tag the packet so its pictures can be matched back to this AU
+				const u64 au_tag = ++next_au_tag;
+				au_info[au_tag] = {au_usrd, attr};
+
+				// AUs the decoder dropped (e.g. skipped frames) never come back
+				while (au_info.size() > 64)
+				{
+					au_info.erase(au_info.begin());
+				}
+
+#ifdef AV_CODEC_FLAG_COPY_OPAQUE
+				packet.opaque = reinterpret_cast<void*>(static_cast<uptr>(au_tag));
+#else
+				ctx->reordered_opaque = au_tag;
+#endif
+
 				ctx->skip_frame =
 					au_mode == CELL_VDEC_DEC_MODE_NORMAL ? AVDISCARD_DEFAULT :
 					au_mode == CELL_VDEC_DEC_MODE_B_SKIP ? AVDISCARD_NONREF : AVDISCARD_NONINTRA;
@@ -404,136 +657,7 @@ struct vdec_context final
 						fmt::throw_exception("AU queuing error (handle=0x%x, seq_id=%d, cmd_id=%d, error=0x%x): %s", handle, cmd->seq_id, cmd->id, ret, utils::av_error_to_string(ret));
 					}
 
-					while (!abort_decode && seq_id == cmd->seq_id)
-					{
-						// Keep receiving frames
-						vdec_frame frame;
-						frame.seq_id = cmd->seq_id;
-						frame.cmd_id = cmd->id;
-						frame.avf.reset(av_frame_alloc());
-
-						if (!frame.avf)
-						{
-							fmt::throw_exception("av_frame_alloc() failed (handle=0x%x, seq_id=%d, cmd_id=%d)", handle, cmd->seq_id, cmd->id);
-						}
-
-						if (int ret = avcodec_receive_frame(ctx, frame.avf.get()); ret < 0)
-						{
-							if (ret == AVERROR(EAGAIN) || ret == AVERROR(EOF))
-							{
-								break;
-							}
-
-							fmt::throw_exception("AU decoding error (handle=0x%x, seq_id=%d, cmd_id=%d, error=0x%x): %s", handle, cmd->seq_id, cmd->id, ret, utils::av_error_to_string(ret));
-						}
-
-						if (frame->interlaced_frame)
-						{
-							// NPEB01838, NPUB31260
-							cellVdec.todo("Interlaced frames not supported (handle=0x%x, seq_id=%d, cmd_id=%d, interlaced_frame=0x%x)", handle, cmd->seq_id, cmd->id, frame->interlaced_frame);
-						}
-
-						if (frame->repeat_pict)
-						{
-							fmt::throw_exception("Repeated frames not supported (handle=0x%x, seq_id=%d, cmd_id=%d, repear_pict=0x%x)", handle, cmd->seq_id, cmd->id, frame->repeat_pict);
-						}
-
-						if (frame->pts != smin)
-						{
-							next_pts = frame->pts;
-						}
-
-						if (frame->pkt_dts != smin)
-						{
-							next_dts = frame->pkt_dts;
-						}
-
-						frame.pts = next_pts;
-						frame.dts = next_dts;
-						frame.userdata = au_usrd;
-						frame.attr = attr;
-
-						if (frc_set)
-						{
-							u64 amend = 0;
-
-							switch (frc_set)
-							{
-							case CELL_VDEC_FRC_24000DIV1001: amend = 1001 * 90000 / 24000; break;
-							case CELL_VDEC_FRC_24: amend = 90000 / 24; break;
-							case CELL_VDEC_FRC_25: amend = 90000 / 25; break;
-							case CELL_VDEC_FRC_30000DIV1001: amend = 1001 * 90000 / 30000; break;
-							case CELL_VDEC_FRC_30: amend = 90000 / 30; break;
-							case CELL_VDEC_FRC_50: amend = 90000 / 50; break;
-							case CELL_VDEC_FRC_60000DIV1001: amend = 1001 * 90000 / 60000; break;
-							case CELL_VDEC_FRC_60: amend = 90000 / 60; break;
-							default:
-							{
-								fmt::throw_exception("Invalid frame rate code set (handle=0x%x, seq_id=%d, cmd_id=%d, frc=0x%x)", handle, cmd->seq_id, cmd->id, frc_set);
-							}
-							}
-
-							next_pts += amend;
-							next_dts += amend;
-							frame.frc = frc_set;
-						}
-						else if (ctx->time_base.num == 0)
-						{
-							if (log_time_base.den != ctx->time_base.den || log_time_base.num != ctx->time_base.num)
-							{
-								cellVdec.error("time_base.num is 0 (handle=0x%x, seq_id=%d, cmd_id=%d, %d/%d, tpf=%d framerate=%d/%d)", handle, cmd->seq_id, cmd->id, ctx->time_base.num, ctx->time_base.den, ctx->ticks_per_frame, ctx->framerate.num, ctx->framerate.den);
-								log_time_base = ctx->time_base;
-							}
-
-							// Hack
-							const u64 amend = u64{90000} / 30;
-							frame.frc = CELL_VDEC_FRC_30;
-							next_pts += amend;
-							next_dts += amend;
-						}
-						else
-						{
-							u64 amend = u64{90000} * ctx->time_base.num * ctx->ticks_per_frame / ctx->time_base.den;
-							const auto freq = 1. * ctx->time_base.den / ctx->time_base.num / ctx->ticks_per_frame;
-
-							if (std::abs(freq - 23.976) < 0.002)
-								frame.frc = CELL_VDEC_FRC_24000DIV1001;
-							else if (std::abs(freq - 24.000) < 0.001)
-								frame.frc = CELL_VDEC_FRC_24;
-							else if (std::abs(freq - 25.000) < 0.001)
-								frame.frc = CELL_VDEC_FRC_25;
-							else if (std::abs(freq - 29.970) < 0.002)
-								frame.frc = CELL_VDEC_FRC_30000DIV1001;
-							else if (std::abs(freq - 30.000) < 0.001)
-								frame.frc = CELL_VDEC_FRC_30;
-							else if (std::abs(freq - 50.000) < 0.001)
-								frame.frc = CELL_VDEC_FRC_50;
-							else if (std::abs(freq - 59.940) < 0.002)
-								frame.frc = CELL_VDEC_FRC_60000DIV1001;
-							else if (std::abs(freq - 60.000) < 0.001)
-								frame.frc = CELL_VDEC_FRC_60;
-							else
-							{
-								if (log_time_base.den != ctx->time_base.den || log_time_base.num != ctx->time_base.num)
-								{
-									// 1/1000 usually means that the time stamps are written in 1ms units and that the frame rate may vary.
-									cellVdec.error("Unsupported time_base (handle=0x%x, seq_id=%d, cmd_id=%d, %d/%d, tpf=%d framerate=%d/%d)", handle, cmd->seq_id, cmd->id, ctx->time_base.num, ctx->time_base.den, ctx->ticks_per_frame, ctx->framerate.num, ctx->framerate.den);
-									log_time_base = ctx->time_base;
-								}
-
-								// Hack
-								amend = u64{90000} / 30;
-								frame.frc = CELL_VDEC_FRC_30;
-							}
-
-							next_pts += amend;
-							next_dts += amend;
-						}
-
-						cellVdec.trace("Got picture (handle=0x%x, seq_id=%d, cmd_id=%d, pts=0x%llx[0x%llx], dts=0x%llx[0x%llx])", handle, cmd->seq_id, cmd->id, frame.pts, frame->pts, frame.dts, frame->pkt_dts);
-
-						decoded_frames.push_back(std::move(frame));
-					}
+					receive_frames(*cmd, decoded_frames);
 				}
 
 				if (thread_ctrl::state() != thread_state::aborting)
@@ -548,45 +672,7 @@ struct vdec_context final
 						--au_count;
 					}
 
-					while (!decoded_frames.empty() && seq_id == cmd->seq_id)
-					{
-						// Wait until there is free space in the image queue.
-						// Do this after pushing the frame to the queue. That way the game can consume the frame and we can move on.
-						u32 elapsed = 0;
-						while (thread_ctrl::state() != thread_state::aborting && !abort_decode && seq_id == cmd->seq_id)
-						{
-							{
-								std::lock_guard lock{mutex};
-
-								if (out_queue.size() <= out_max)
-								{
-									break;
-								}
-							}
-							thread_ctrl::wait_for(1000);
-
-							if (elapsed++ >= 5000) // 5 seconds
-							{
-								cellVdec.error("Video au decode has been waiting for a consumer for 5 seconds. (handle=0x%x, seq_id=%d, cmd_id=%d, queue_size=%d)", handle, cmd->seq_id, cmd->id, out_queue.size());
-								elapsed = 0;
-							}
-						}
-
-						if (thread_ctrl::state() == thread_state::aborting || abort_decode || seq_id != cmd->seq_id)
-						{
-							break;
-						}
-
-						{
-							std::lock_guard lock{mutex};
-							out_queue.push_back(std::move(decoded_frames.front()));
-							decoded_frames.pop_front();
-						}
-
-						cellVdec.trace("Sending CELL_VDEC_MSG_TYPE_PICOUT (handle=0x%x, seq_id=%d, cmd_id=%d)", handle, cmd->seq_id, cmd->id);
-						cb_func(ppu, vid, CELL_VDEC_MSG_TYPE_PICOUT, CELL_OK, cb_arg);
-						lv2_obj::sleep(ppu);
-					}
+					output_frames(ppu, vid, *cmd, decoded_frames);
 				}
 
 				if (abort_decode || seq_id != cmd->seq_id)
@@ -1251,12 +1337,12 @@ error_code cellVdecGetPictureExt(u32 handle, vm::cptr<CellVdecPicFormat2> format
 
 		AVPixelFormat out_f = AV_PIX_FMT_YUV420P;
 
-		std::unique_ptr<u8[]> alpha_plane;
+		bool has_alpha = false;
 
 		switch (const u32 type = format->formatType)
 		{
-		case CELL_VDEC_PICFMT_ARGB32_ILV: out_f = AV_PIX_FMT_ARGB; alpha_plane.reset(new u8[w * h]); break;
-		case CELL_VDEC_PICFMT_RGBA32_ILV: out_f = AV_PIX_FMT_RGBA; alpha_plane.reset(new u8[w * h]); break;
+		case CELL_VDEC_PICFMT_ARGB32_ILV: out_f = AV_PIX_FMT_ARGB; has_alpha = true; break;
+		case CELL_VDEC_PICFMT_RGBA32_ILV: out_f = AV_PIX_FMT_RGBA; has_alpha = true; break;
 		case CELL_VDEC_PICFMT_UYVY422_ILV: out_f = AV_PIX_FMT_UYVY422; break;
 		case CELL_VDEC_PICFMT_YUV420_PLANAR: out_f = AV_PIX_FMT_YUV420P; break;
 		default:
@@ -1267,11 +1353,6 @@ error_code cellVdecGetPictureExt(u32 handle, vm::cptr<CellVdecPicFormat2> format
 
 		// TODO: color matrix
 
-		if (alpha_plane)
-		{
-			std::memset(alpha_plane.get(), format->alpha, w * h);
-		}
-
 		AVPixelFormat in_f = AV_PIX_FMT_YUV420P;
 
 		switch (frame->format)
@@ -1280,13 +1361,34 @@ error_code cellVdecGetPictureExt(u32 handle, vm::cptr<CellVdecPicFormat2> format
 			cellVdec.error("cellVdecGetPictureExt: experimental AVPixelFormat (handle=0x%x, seq_id=%d, cmd_id=%d, format=%d). This may cause suboptimal video quality.", handle, frame.seq_id, frame.cmd_id, frame->format);
 			[[fallthrough]];
 		case AV_PIX_FMT_YUV420P:
-			in_f = alpha_plane ? AV_PIX_FMT_YUVA420P : static_cast<AVPixelFormat>(frame->format);
+			in_f = has_alpha ? AV_PIX_FMT_YUVA420P : static_cast<AVPixelFormat>(frame->format);
 			break;
 		default:
 			fmt::throw_exception("cellVdecGetPictureExt: Unknown frame format (%d)", frame->format);
 		}
 
-		cellVdec.trace("cellVdecGetPictureExt: handle=0x%x, seq_id=%d, cmd_id=%d, w=%d, h=%d, frameFormat=%d, formatType=%d, in_f=%d, out_f=%d, alpha_plane=%d, alpha=%d, colorMatrixType=%d", handle, frame.seq_id, frame.cmd_id, w, h, frame->format, format->formatType, +in_f, +out_f, !!alpha_plane, format->alpha, format->colorMatrixType);
+		cellVdec.trace("cellVdecGetPictureExt: handle=0x%x, seq_id=%d, cmd_id=%d, w=%d, h=%d, frameFormat=%d, formatType=%d, in_f=%d, out_f=%d, has_alpha=%d, alpha=%d, colorMatrixType=%d", handle, frame.seq_id, frame.cmd_id, w, h, frame->format, format->formatType, +in_f, +out_f, has_alpha, format->alpha, format->colorMatrixType);
+
+		if (has_alpha && frame->format == AV_PIX_FMT_YUV420P)
+		{
+			// Limited range YUV to RGB is converted in-tree, swscale handles the rest
+			const utils::yuv420_planes planes{ frame->data[0], frame->data[1], frame->data[2], frame->linesize[0], frame->linesize[1] };
+			const auto order = out_f == AV_PIX_FMT_ARGB ? utils::rgba32_order::argb : utils::rgba32_order::rgba;
+
+			if (utils::convert_yuv420_to_rgba32(outBuff.get_ptr(), w * 4, planes, w, h, format->alpha, order))
+			{
+				return CELL_OK;
+			}
+		}
+
+		// Only the swscale path needs a constant alpha plane
+		std::unique_ptr<u8[]> alpha_plane;
+
+		if (has_alpha)
+		{
+			alpha_plane.reset(new u8[w * h]);
+			std::memset(alpha_plane.get(), format->alpha, w * h);
+		}
 
 		vdec->sws = sws_getCachedContext(vdec->sws, w, h, in_f, w, h, out_f, SWS_POINT, nullptr, nullptr, nullptr);
 
@@ -1295,7 +1397,7 @@ error_code cellVdecGetPictureExt(u32 handle, vm::cptr<CellVdecPicFormat2> format
 		u8* out_data[4] = { outBuff.get_ptr() };
 		int out_line[4] = { w * 4 }; // RGBA32 or ARGB32
 
-		if (!alpha_plane)
+		if (!has_alpha)
 		{
 			// YUV420P or UYVY422
 			out_data[1] = out_data[0] + w * h;
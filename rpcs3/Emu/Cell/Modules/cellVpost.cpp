@@ -22,6 +22,8 @@ extern "C"
 
 #include "cellVpost.h"
 
+#include "util/image_scaler.hpp"
+
 LOG_CHANNEL(cellVpost);
 
 template<>
@@ -270,6 +272,13 @@ error_code cellVpostExec(u32 handle, vm::cptr<u8> inPicBuff, vm::cptr<CellVpostC
 	picInfo->reserved1 = 0;
 	picInfo->reserved2 = 0;
 
+	const utils::yuv420_planes planes{ &inPicBuff[0], &inPicBuff[w * h], &inPicBuff[w * h * 5 / 4], static_cast<int>(w), static_cast<int>(w / 2) };
+
+	if (utils::convert_scale_yuv420_to_rgba32(outPicBuff.get_ptr(), ow, oh, ow * 4, planes, w, h, ctrlParam->outAlpha, utils::rgba32_order::rgba, true, vpost->scratch))
+	{
+		return CELL_OK;
+	}
+
 	//u64 stamp0 = get_guest_system_time();
 	std::unique_ptr<u8[]> pA(new u8[w*h]);
 
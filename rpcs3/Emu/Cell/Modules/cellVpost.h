@@ -345,6 +345,7 @@ public:
 	const bool to_rgba;
 
 	SwsContext* sws{};
+	std::vector<u8> scratch; // Intermediate RGBA picture for the in-tree scaler
 
 	VpostInstance(bool rgba)
 		: to_rgba(rgba)
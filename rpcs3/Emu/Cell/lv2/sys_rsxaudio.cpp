@@ -10,6 +10,23 @@
 #include <bitset>
 #include <optional>
 
+#if defined(ARCH_X64)
+#include "emmintrin.h"
+#endif
+
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#endif
+
+#ifdef ARCH_ARM64
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif
+#undef FORCE_INLINE
+#include "Emu/CPU/sse2neon.h"
+#endif
+
 #ifdef __linux__
 #include <sys/epoll.h>
 #include <sys/timerfd.h>
@@ -21,6 +38,159 @@
 
 LOG_CHANNEL(sys_rsxaudio);
 
+namespace rsxaudio_pcm
+{
+	// Byte swaps every 16-bit lane
+	static inline __m128i bswap16(__m128i v)
+	{
+		return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+	}
+
+	// Byte swaps every 32-bit lane
+	static inline __m128i bswap32(__m128i v)
+	{
+		return bswap16(_mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xb1), 0xb1));
+	}
+
+	static inline __m128i load(const void* src)
+	{
+		return _mm_loadu_si128(static_cast<const __m128i*>(src));
+	}
+
+	// Big-endian PCM to float, count must be a multiple of 8 (16-bit) or 4 (32-bit)
+	static void s16be_to_f32(f32* dst, const be_t<s16>* src, u32 count)
+	{
+		const __m128 scale = _mm_set1_ps(1.0f / 32768.0f);
+
+		for (u32 i = 0; i < count; i += 8)
+		{
+			const __m128i v = bswap16(load(src + i));
+			const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+			const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+			_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+			_mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+		}
+	}
+
+	static void s32be_to_f32(f32* dst, const be_t<s32>* src, u32 count)
+	{
+		const __m128 scale = _mm_set1_ps(1.0f / 2147483648.0f);
+
+		for (u32 i = 0; i < count; i += 4)
+		{
+			_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(bswap32(load(src + i))), scale));
+		}
+	}
+
+	// Interleaved big-endian stereo PCM to two float planes, frame_count must be a multiple of 4
+	static void s16be_stereo_to_f32(f32* dst_l, f32* dst_r, const be_t<s16>* src, u32 frame_count)
+	{
+		const __m128 scale = _mm_set1_ps(1.0f / 32768.0f);
+
+		for (u32 i = 0; i < frame_count; i += 4)
+		{
+			// Each 32-bit lane holds one frame, left sample in the low half
+			const __m128i v = bswap16(load(src + i * 2));
+			const __m128i left = _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+			const __m128i right = _mm_srai_epi32(v, 16);
+			_mm_storeu_ps(dst_l + i, _mm_mul_ps(_mm_cvtepi32_ps(left), scale));
+			_mm_storeu_ps(dst_r + i, _mm_mul_ps(_mm_cvtepi32_ps(right), scale));
+		}
+	}
+
+	static void s32be_stereo_to_f32(f32* dst_l, f32* dst_r, const be_t<s32>* src, u32 frame_count)
+	{
+		const __m128 scale = _mm_set1_ps(1.0f / 2147483648.0f);
+
+		for (u32 i = 0; i < frame_count; i += 4)
+		{
+			const __m128 v0 = _mm_mul_ps(_mm_cvtepi32_ps(bswap32(load(src + i * 2))), scale);
+			const __m128 v1 = _mm_mul_ps(_mm_cvtepi32_ps(bswap32(load(src + i * 2 + 4))), scale);
+			_mm_storeu_ps(dst_l + i, _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(dst_r + i, _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+	}
+}
+
+template <usz output_ch_cnt>
+void rsxaudio_data_container::interleave(const std::array<const ra_stream_blk_t*, output_ch_cnt>& channels, u32 sample_cnt, f32* data_out)
+{
+	if constexpr (output_ch_cnt == 2)
+	{
+		const f32* left = channels[0]->data();
+		const f32* right = channels[1]->data();
+
+		for (u32 i = 0; i < sample_cnt; i += 4)
+		{
+			const __m128 l = _mm_loadu_ps(left + i);
+			const __m128 r = _mm_loadu_ps(right + i);
+			_mm_storeu_ps(data_out + i * 2, _mm_unpacklo_ps(l, r));
+			_mm_storeu_ps(data_out + i * 2 + 4, _mm_unpackhi_ps(l, r));
+		}
+	}
+	else if constexpr (output_ch_cnt == 6 || output_ch_cnt == 8)
+	{
+		// Transpose 4 samples of 4 channels at a time
+		for (u32 i = 0; i < sample_cnt; i += 4)
+		{
+			f32* out = data_out + i * output_ch_cnt;
+
+			__m128 c0 = _mm_loadu_ps(channels[0]->data() + i);
+			__m128 c1 = _mm_loadu_ps(channels[1]->data() + i);
+			__m128 c2 = _mm_loadu_ps(channels[2]->data() + i);
+			__m128 c3 = _mm_loadu_ps(channels[3]->data() + i);
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+			__m128 c4 = _mm_loadu_ps(channels[4]->data() + i);
+			__m128 c5 = _mm_loadu_ps(channels[5]->data() + i);
+
+			if constexpr (output_ch_cnt == 8)
+			{
+				__m128 c6 = _mm_loadu_ps(channels[6]->data() + i);
+				__m128 c7 = _mm_loadu_ps(channels[7]->data() + i);
+				_MM_TRANSPOSE4_PS(c4, c5, c6, c7);
+
+				_mm_storeu_ps(out + 0, c0);
+				_mm_storeu_ps(out + 4, c4);
+				_mm_storeu_ps(out + 8, c1);
+				_mm_storeu_ps(out + 12, c5);
+				_mm_storeu_ps(out + 16, c2);
+				_mm_storeu_ps(out + 20, c6);
+				_mm_storeu_ps(out + 24, c3);
+				_mm_storeu_ps(out + 28, c7);
+			}
+			else
+			{
+				const __m128 lo = _mm_unpacklo_ps(c4, c5); // Samples 0 and 1
+				const __m128 hi = _mm_unpackhi_ps(c4, c5); // Samples 2 and 3
+
+				_mm_storeu_ps(out + 0, c0);
+				_mm_storel_pi(reinterpret_cast<__m64*>(out + 4), lo);
+				_mm_storeu_ps(out + 6, c1);
+				_mm_storeh_pi(reinterpret_cast<__m64*>(out + 10), lo);
+				_mm_storeu_ps(out + 12, c2);
+				_mm_storel_pi(reinterpret_cast<__m64*>(out + 16), hi);
+				_mm_storeu_ps(out + 18, c3);
+				_mm_storeh_pi(reinterpret_cast<__m64*>(out + 22), hi);
+			}
+		}
+	}
+	else
+	{
+		for (u32 i = 0; i < sample_cnt; i++)
+		{
+			for (usz ch = 0; ch < output_ch_cnt; ch++)
+			{
+				data_out[i * output_ch_cnt + ch] = (*channels[ch])[i];
+			}
+		}
+	}
+}
+
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic pop
+#endif
+
 namespace rsxaudio_ringbuf_reader
 {
 	static constexpr void clean_buf(rsxaudio_shmem::ringbuf_t& ring_buf)
@@ -1150,39 +1320,29 @@ bool rsxaudio_data_thread::calc_port_active_state(RsxaudioPort port, const rsxau
 	}
 }
 
-f32 rsxaudio_data_thread::pcm_to_float(s32 sample)
-{
-	return sample * (1.0f / 2147483648.0f);
-}
-
-f32 rsxaudio_data_thread::pcm_to_float(s16 sample)
-{
-	return sample * (1.0f / 32768.0f);
-}
-
 void rsxaudio_data_thread::pcm_serial_process_channel(RsxaudioSampleSize word_bits, ra_stream_blk_t& buf_out_l, ra_stream_blk_t& buf_out_r, const void* buf_in, u8 src_stream)
 {
 	const u8 input_word_sz = static_cast<u8>(word_bits);
-	u64 ch_dst = 0;
 
-	for (u64 blk_idx = 0; blk_idx < SYS_RSXAUDIO_STREAM_DATA_BLK_CNT; blk_idx++)
+	// Each data block of a stream holds the left samples followed by the right ones
+	const u32 samples_per_half = SYS_RSXAUDIO_DATA_BLK_SIZE / 2 / input_word_sz;
+	u32 ch_dst = 0;
+
+	for (u64 blk_idx = 0; blk_idx < SYS_RSXAUDIO_STREAM_DATA_BLK_CNT; blk_idx++, ch_dst += samples_per_half)
 	{
-		for (u64 offset = 0; offset < SYS_RSXAUDIO_DATA_BLK_SIZE / 2; offset += input_word_sz, ch_dst++)
-		{
-			const u64 left_ch_src = (blk_idx * SYS_RSXAUDIO_STREAM_SIZE + src_stream * SYS_RSXAUDIO_DATA_BLK_SIZE + offset) / input_word_sz;
-			const u64 right_ch_src = left_ch_src + (SYS_RSXAUDIO_DATA_BLK_SIZE / 2) / input_word_sz;
+		const u8* const left_src = static_cast<const u8*>(buf_in) + blk_idx * SYS_RSXAUDIO_STREAM_SIZE + src_stream * SYS_RSXAUDIO_DATA_BLK_SIZE;
+		const u8* const right_src = left_src + SYS_RSXAUDIO_DATA_BLK_SIZE / 2;
 
-			if (word_bits == RsxaudioSampleSize::_16BIT)
-			{
-				buf_out_l[ch_dst] = pcm_to_float(static_cast<const be_t<s16>*>(buf_in)[left_ch_src]);
-				buf_out_r[ch_dst] = pcm_to_float(static_cast<const be_t<s16>*>(buf_in)[right_ch_src]);
-			}
-			else
-			{
-				// Looks like rsx treats 20bit/24bit samples as 32bit ones
-				buf_out_l[ch_dst] = pcm_to_float(static_cast<const be_t<s32>*>(buf_in)[left_ch_src]);
-				buf_out_r[ch_dst] = pcm_to_float(static_cast<const be_t<s32>*>(buf_in)[right_ch_src]);
-			}
+		if (word_bits == RsxaudioSampleSize::_16BIT)
+		{
+			rsxaudio_pcm::s16be_to_f32(buf_out_l.data() + ch_dst, reinterpret_cast<const be_t<s16>*>(left_src), samples_per_half);
+			rsxaudio_pcm::s16be_to_f32(buf_out_r.data() + ch_dst, reinterpret_cast<const be_t<s16>*>(right_src), samples_per_half);
+		}
+		else
+		{
+			// Looks like rsx treats 20bit/24bit samples as 32bit ones
+			rsxaudio_pcm::s32be_to_f32(buf_out_l.data() + ch_dst, reinterpret_cast<const be_t<s32>*>(left_src), samples_per_half);
+			rsxaudio_pcm::s32be_to_f32(buf_out_r.data() + ch_dst, reinterpret_cast<const be_t<s32>*>(right_src), samples_per_half);
 		}
 	}
 }
@@ -1190,23 +1350,16 @@ void rsxaudio_data_thread::pcm_serial_process_channel(RsxaudioSampleSize word_bi
 void rsxaudio_data_thread::pcm_spdif_process_channel(RsxaudioSampleSize word_bits, ra_stream_blk_t& buf_out_l, ra_stream_blk_t& buf_out_r, const void* buf_in)
 {
 	const u8 input_word_sz = static_cast<u8>(word_bits);
+	const u32 frame_cnt = SYS_RSXAUDIO_RINGBUF_BLK_SZ_SPDIF / (input_word_sz * SYS_RSXAUDIO_SPDIF_MAX_CH);
 
-	for (u64 offset = 0; offset < SYS_RSXAUDIO_RINGBUF_BLK_SZ_SPDIF / (input_word_sz * SYS_RSXAUDIO_SPDIF_MAX_CH); offset++)
+	if (word_bits == RsxaudioSampleSize::_16BIT)
 	{
-		const u64 left_ch_src = offset * SYS_RSXAUDIO_SPDIF_MAX_CH;
-		const u64 right_ch_src = left_ch_src + 1;
-
-		if (word_bits == RsxaudioSampleSize::_16BIT)
-		{
-			buf_out_l[offset] = pcm_to_float(static_cast<const be_t<s16>*>(buf_in)[left_ch_src]);
-			buf_out_r[offset] = pcm_to_float(static_cast<const be_t<s16>*>(buf_in)[right_ch_src]);
-		}
-		else
-		{
-			// Looks like rsx treats 20bit/24bit samples as 32bit ones
-			buf_out_l[offset] = pcm_to_float(static_cast<const be_t<s32>*>(buf_in)[left_ch_src]);
-			buf_out_r[offset] = pcm_to_float(static_cast<const be_t<s32>*>(buf_in)[right_ch_src]);
-		}
+		rsxaudio_pcm::s16be_stereo_to_f32(buf_out_l.data(), buf_out_r.data(), static_cast<const be_t<s16>*>(buf_in), frame_cnt);
+	}
+	else
+	{
+		// Looks like rsx treats 20bit/24bit samples as 32bit ones
+		rsxaudio_pcm::s32be_stereo_to_f32(buf_out_l.data(), buf_out_r.data(), static_cast<const be_t<s32>*>(buf_in), frame_cnt);
 	}
 }
 
@@ -381,10 +381,14 @@ private:
 	rsxaudio_data_container(rsxaudio_data_container&&) = delete;
 	rsxaudio_data_container& operator=(rsxaudio_data_container&&) = delete;
 
+	// Interleaves sample_cnt samples of every channel into data_out
+	template <usz output_ch_cnt>
+	static void interleave(const std::array<const ra_stream_blk_t*, output_ch_cnt>& channels, u32 sample_cnt, f32* data_out);
+
 	// Mix individual channels into final PCM stream. Channels in channel map that are > input_ch_cnt treated as silent.
 	template<usz output_ch_cnt, usz input_ch_cnt>
 	requires (output_ch_cnt > 0 && output_ch_cnt <= 8 && input_ch_cnt > 0)
-	constexpr void mix(const std::array<u8, 8> &ch_map, RsxaudioSampleSize sample_size, const std::array<ra_stream_blk_t, input_ch_cnt> &input_channels, data_blk_t& data_out)
+	void mix(const std::array<u8, 8> &ch_map, RsxaudioSampleSize sample_size, const std::array<ra_stream_blk_t, input_ch_cnt> &input_channels, data_blk_t& data_out)
 	{
 		const ra_stream_blk_t silent_channel{};
 
@@ -404,19 +408,7 @@ private:
 
 		const u32 samples_in_buf = sample_size == RsxaudioSampleSize::_16BIT ? SYS_RSXAUDIO_STREAM_SAMPLE_CNT * 2 : SYS_RSXAUDIO_STREAM_SAMPLE_CNT;
 
-		for (u32 sample_idx = 0; sample_idx < samples_in_buf * output_ch_cnt; sample_idx += output_ch_cnt)
-		{
-			const u32 src_sample_idx = sample_idx / output_ch_cnt;
-
-			if constexpr (output_ch_cnt >= 1) data_out[sample_idx + 0] = (*real_input_ch[0])[src_sample_idx];
-			if constexpr (output_ch_cnt >= 2) data_out[sample_idx + 1] = (*real_input_ch[1])[src_sample_idx];
-			if constexpr (output_ch_cnt >= 3) data_out[sample_idx + 2] = (*real_input_ch[2])[src_sample_idx];
-			if constexpr (output_ch_cnt >= 4) data_out[sample_idx + 3] = (*real_input_ch[3])[src_sample_idx];
-			if constexpr (output_ch_cnt >= 5) data_out[sample_idx + 4] = (*real_input_ch[4])[src_sample_idx];
-			if constexpr (output_ch_cnt >= 6) data_out[sample_idx + 5] = (*real_input_ch[5])[src_sample_idx];
-			if constexpr (output_ch_cnt >= 7) data_out[sample_idx + 6] = (*real_input_ch[6])[src_sample_idx];
-			if constexpr (output_ch_cnt >= 8) data_out[sample_idx + 7] = (*real_input_ch[7])[src_sample_idx];
-		}
+		interleave<output_ch_cnt>(real_input_ch, samples_in_buf, data_out.data());
 	}
 };
 
@@ -606,8 +598,6 @@ private:
 	void extract_audio_data();
 	static std::pair<bool /*data_present*/, void* /*addr*/> get_ringbuf_addr(RsxaudioPort dst, const lv2_rsxaudio& rsxaudio_obj);
 
-	static f32 pcm_to_float(s32 sample);
-	static f32 pcm_to_float(s16 sample);
 	static void pcm_serial_process_channel(RsxaudioSampleSize word_bits, ra_stream_blk_t& buf_out_l, ra_stream_blk_t& buf_out_r, const void* buf_in, u8 src_stream);
 	static void pcm_spdif_process_channel(RsxaudioSampleSize word_bits, ra_stream_blk_t& buf_out_l, ra_stream_blk_t& buf_out_r, const void* buf_in);
 	bool enqueue_data(RsxaudioPort dst, bool silence, const void* src_addr, const rsxaudio_hw_param_t& hwp);
@@ -7,12 +7,149 @@
 #include "Emu/RSX/RSXThread.h"
 #include "Emu/Memory/vm.h"
 
+#include "Utilities/lockless.h"
+#include "Utilities/Thread.h"
+
 #include "xxhash.h"
+#include <zlib.h>
 
 namespace rsx
 {
 	namespace capture
 	{
+		struct capture_file_writer
+		{
+			struct pending_block
+			{
+				u64 hash;
+				std::vector<u8> data;
+			};
+
+			fs::pending_file out;
+			lf_queue<pending_block> m_work_queue;
+			atomic_t<u64> m_enqueued_count = 0;
+			atomic_t<u64> m_processed_count = 0;
+
+			// Owned by the writer thread until flushed
+			std::unordered_map<u64, frame_capture_data::memory_block_chunk> m_chunks;
+			u64 m_write_offset = sizeof(frame_capture_file_header);
+			bool m_failed = false;
+
+			capture_file_writer(const std::string& path)
+				: out(path)
+			{
+			}
+
+			void write_block(u64 hash, const std::vector<u8>& data)
+			{
+				frame_capture_data::memory_block_chunk chunk{};
+				chunk.file_offset = m_write_offset;
+				chunk.size = ::size32(data);
+				chunk.compressed_size = chunk.size;
+
+				std::vector<u8> compressed(compressBound(static_cast<uLong>(data.size())));
+				uLongf compressed_size = static_cast<uLongf>(compressed.size());
+
+				const void* src = data.data();
+
+				// Keep the raw data if compression does not help
+				if (compress2(compressed.data(), &compressed_size, data.data(), static_cast<uLong>(data.size()), Z_BEST_SPEED) == Z_OK && compressed_size < data.size())
+				{
+					chunk.compressed_size = static_cast<u32>(compressed_size);
+					src = compressed.data();
+				}
+
+				if (out.file.write(src, chunk.compressed_size) != chunk.compressed_size)
+				{
+					m_failed = true;
+				}
+
+				m_write_offset += chunk.compressed_size;
+				m_chunks.emplace(hash, chunk);
+			}
+
+			void operator()()
+			{
+				while (thread_ctrl::state() != thread_state::aborting)
+				{
+					for (auto&& job : m_work_queue.pop_all())
+					{
+						write_block(job.hash, job.data);
+						m_processed_count.release(m_processed_count + 1);
+					}
+
+					thread_ctrl::wait_on(m_work_queue, nullptr);
+				}
+			}
+
+			static constexpr auto thread_name = "RSX Capture Writer"sv;
+		};
+
+		static std::unique_ptr<named_thread<capture_file_writer>> s_capture_writer;
+
+		bool begin_capture_file(const std::string& path)
+		{
+			s_capture_writer = std::make_unique<named_thread<capture_file_writer>>(path);
+
+			// Header is rewritten with the metadata offset on commit
+			const frame_capture_file_header header{};
+			if (!s_capture_writer->out.file || s_capture_writer->out.file.write(&header, sizeof(header)) != sizeof(header))
+			{
+				s_capture_writer.reset();
+				return false;
+			}
+
+			return true;
+		}
+
+		void flush_capture_file()
+		{
+			if (!s_capture_writer)
+			{
+				return;
+			}
+
+			while (s_capture_writer->m_processed_count < s_capture_writer->m_enqueued_count)
+			{
+				std::this_thread::yield();
+			}
+
+			for (const auto& [hash, chunk] : s_capture_writer->m_chunks)
+			{
+				frame_capture.memory_data_map[hash] = chunk;
+			}
+		}
+
+		bool commit_capture_file(const std::vector<u8>& metadata)
+		{
+			if (!s_capture_writer)
+			{
+				return false;
+			}
+
+			auto& writer = *s_capture_writer;
+
+			frame_capture_file_header header{};
+			header.magic = c_fc_magic;
+			header.version = c_fc_version;
+			header.LE_format = u32{std::endian::little == std::endian::native};
+			header.metadata_offset = writer.m_write_offset;
+
+			const bool result = !writer.m_failed &&
+				writer.out.file.write(metadata.data(), metadata.size()) == metadata.size() &&
+				writer.out.file.seek(0) == 0 &&
+				writer.out.file.write(&header, sizeof(header)) == sizeof(header) &&
+				writer.out.commit(false);
+
+			s_capture_writer.reset();
+			return result;
+		}
+
+		void abort_capture_file()
+		{
+			s_capture_writer.reset();
+		}
+
 		void insert_mem_block_in_map(std::unordered_set<u64>& mem_changes, frame_capture_data::memory_block&& block, frame_capture_data::memory_block_data&& data)
 		{
 			if (!data.data.empty())
@@ -23,12 +160,20 @@ namespace rsx
 				auto it = frame_capture.memory_data_map.find(data_hash);
 				if (it != frame_capture.memory_data_map.end())
 				{
-					if (it->second.data != data.data)
+					// Block contents are only kept by the writer, a size mismatch is the cheap tell for a collision
+					if (it->second.size != data.data.size())
 						// screw this
 						fmt::throw_exception("Memory map hash collision detected...cant capture");
 				}
 				else
-					frame_capture.memory_data_map.insert(std::make_pair(data_hash, std::move(data)));
+				{
+					frame_capture_data::memory_block_chunk chunk{};
+					chunk.size = ::size32(data.data);
+					frame_capture.memory_data_map.emplace(data_hash, chunk);
+
+					ensure(s_capture_writer)->m_enqueued_count++;
+					s_capture_writer->m_work_queue.push(data_hash, std::move(data.data));
+				}
 
 				u64 block_hash = XXH64(&block, sizeof(frame_capture_data::memory_block), 0);
 				mem_changes.insert(block_hash);
@@ -10,5 +10,11 @@ namespace rsx
 		void capture_image_in(thread* rsx, frame_capture_data::replay_command& replay_command);
 		void capture_buffer_notify(thread* rsx, frame_capture_data::replay_command& replay_command);
 		void capture_display_tile_state(thread* rsx, frame_capture_data::replay_command& replay_command);
+
+		// Streaming capture file writer, memory blocks are compressed and written out while capturing
+		bool begin_capture_file(const std::string& path);
+		void flush_capture_file();
+		bool commit_capture_file(const std::vector<u8>& metadata);
+		void abort_capture_file();
 	}
 }
@@ -8,6 +8,9 @@
 
 #include "util/asm.hpp"
 
+#include <numeric>
+#include <zlib.h>
+
 namespace rsx
 {
 	be_t<u32> rsx_replay_thread::allocate_context()
@@ -98,6 +101,52 @@ namespace rsx
 		return fifo_stops;
 	}
 
+	const std::vector<u8>& rsx_replay_thread::load_memory_block(u64 data_hash)
+	{
+		// Keep up to 1GB of decompressed blocks around, larger captures stream from disk every iteration
+		constexpr usz max_cache_size = 0x4000'0000;
+
+		if (auto found = block_cache.find(data_hash); found != block_cache.end())
+		{
+			return found->second;
+		}
+
+		auto it = frame->memory_data_map.find(data_hash);
+		if (it == frame->memory_data_map.end())
+			fmt::throw_exception("requested memory data state for command not found in memory_data_map");
+
+		const auto& chunk = it->second;
+
+		std::vector<u8> compressed(chunk.compressed_size);
+		if (data_file.seek(chunk.file_offset) != chunk.file_offset || data_file.read(compressed.data(), compressed.size()) != compressed.size())
+			fmt::throw_exception("Capture Replay: failed to read memory block at offset 0x%x", chunk.file_offset);
+
+		std::vector<u8> data;
+
+		if (chunk.compressed_size == chunk.size)
+		{
+			data = std::move(compressed);
+		}
+		else
+		{
+			data.resize(chunk.size);
+
+			uLongf size = chunk.size;
+			if (uncompress(data.data(), &size, compressed.data(), chunk.compressed_size) != Z_OK || size != chunk.size)
+				fmt::throw_exception("Capture Replay: failed to decompress memory block at offset 0x%x", chunk.file_offset);
+		}
+
+		if (block_cache_size + data.size() > max_cache_size)
+		{
+			// Over budget, serve from the scratch block
+			block_scratch = std::move(data);
+			return block_scratch;
+		}
+
+		block_cache_size += data.size();
+		return block_cache[data_hash] = std::move(data);
+	}
+
 	void rsx_replay_thread::apply_frame_state(be_t<u32> context_id, const frame_capture_data::replay_command& replay_cmd)
 	{
 		// apply memory needed for command
@@ -108,12 +157,8 @@ namespace rsx
 				fmt::throw_exception("requested memory state for command not found in memory_map");
 
 			const auto& memblock = it->second;
-			auto it_data = frame->memory_data_map.find(it->second.data_state);
-			if (it_data == frame->memory_data_map.end())
-				fmt::throw_exception("requested memory data state for command not found in memory_data_map");
-
-			const auto& data_block = it_data->second;
-			std::memcpy(vm::base(get_address(memblock.offset, memblock.location)), data_block.data.data(), data_block.data.size());
+			const auto& data_block = load_memory_block(memblock.data_state);
+			std::memcpy(vm::base(get_address(memblock.offset, memblock.location)), data_block.data(), data_block.size());
 		}
 
 		if (replay_cmd.display_buffer_state != 0 && replay_cmd.display_buffer_state != cs.display_buffer_hash)
@@ -173,8 +218,16 @@ namespace rsx
 
 		auto fifo_stops = alloc_write_fifo(context_id);
 
+		std::vector<u64> iteration_times;
+		iteration_times.reserve(bench_iterations);
+
+		// Per-frame statistics are only collected for the benchmark report
+		get_current_renderer()->record_frame_stats = bench_iterations != 0;
+
 		while (!Emu.IsStopped())
 		{
+			const u64 iteration_start = rsx::uclock();
+
 			// Load registers while the RSX is still idle
 			method_registers = frame->reg_state;
 			atomic_fence_seq_cst();
@@ -234,10 +287,101 @@ namespace rsx
 				render->request_emu_flip(1u);
 			}
 
-			// random pause to not destroy gpu
-			thread_ctrl::wait_for(10'000);
+			if (!bench_iterations)
+			{
+				// random pause to not destroy gpu
+				thread_ctrl::wait_for(10'000);
+				continue;
+			}
+
+			// Wait for the frame to be retired so that its statistics are published
+			while (render->int_flip_index == last_flip && !Emu.IsStopped())
+			{
+				std::this_thread::yield();
+			}
+
+			iteration_times.push_back(rsx::uclock() - iteration_start);
+
+			if (iteration_times.size() >= bench_iterations)
+			{
+				report_benchmark(iteration_times);
+
+				Emu.CallFromMainThread([]()
+				{
+					Emu.GracefulShutdown(false);
+					Emu.Quit(true);
+				});
+
+				break;
+			}
 		}
 
 		get_current_cpu_thread()->state += (cpu_flag::exit + cpu_flag::wait);
 	}
+
+	void rsx_replay_thread::report_benchmark(const std::vector<u64>& iteration_times) const
+	{
+		std::vector<frame_statistics_t> frames;
+
+		get_current_renderer()->record_frame_stats = false;
+
+		for (auto&& stats : get_current_renderer()->frame_stats_log.pop_all())
+		{
+			frames.push_back(stats);
+		}
+
+		if (frames.empty())
+		{
+			rsx_log.error("RSX benchmark: no frame statistics were recorded");
+			return;
+		}
+
+		std::vector<std::string> lines;
+		lines.push_back(fmt::format("RSX benchmark: %u iterations, %u frames, %u draw calls per frame", iteration_times.size(), frames.size(), frames.back().draw_calls));
+
+		auto report = [&](std::string_view name, std::string_view unit, auto&& get)
+		{
+			u64 total = 0, min_value = umax, max_value = 0;
+
+			for (const auto& stats : frames)
+			{
+				const u64 value = get(stats);
+				total += value;
+				min_value = std::min(min_value, value);
+				max_value = std::max(max_value, value);
+			}
+
+			lines.push_back(fmt::format("%-26s avg %10u%s, min %10u%s, max %10u%s", name, total / frames.size(), unit, min_value, unit, max_value, unit));
+		};
+
+		// Handler time includes the draw preparation timed separately below
+		const auto draw_prep_time = [](const frame_statistics_t& stats)
+		{
+			return stats.setup_time + stats.vertex_upload_time + stats.textures_upload_time;
+		};
+
+		report("FIFO decode:", "us", [](const frame_statistics_t& stats) { return static_cast<u64>(std::max<s64>(stats.fifo_time - stats.method_time, 0)); });
+		report("Method handlers:", "us", [&](const frame_statistics_t& stats) { return static_cast<u64>(std::max<s64>(stats.method_time - draw_prep_time(stats), 0)); });
+		report("Shader prefetch:", "us", [](const frame_statistics_t& stats) { return static_cast<u64>(stats.setup_time); });
+		report("Vertex/index preparation:", "us", [](const frame_statistics_t& stats) { return static_cast<u64>(stats.vertex_upload_time); });
+		report("Texture preparation:", "us", [](const frame_statistics_t& stats) { return static_cast<u64>(stats.textures_upload_time); });
+		report("Redundant writes skipped:", "", [](const frame_statistics_t& stats) { return u64{stats.redundant_writes}; });
+		report("Bytes prepared:", "KB", [](const frame_statistics_t& stats) { return stats.upload_bytes / 1024; });
+		report("Preparation bandwidth:", "MB/s", [&](const frame_statistics_t& stats)
+		{
+			const s64 time = draw_prep_time(stats);
+			return time > 0 ? stats.upload_bytes / static_cast<u64>(time) : 0;
+		});
+
+		const u64 total_time = std::accumulate(iteration_times.begin(), iteration_times.end(), u64{0});
+		lines.push_back(fmt::format("%-26s avg %10u%s", "Iteration time:", total_time / iteration_times.size(), "us"));
+
+		for (const auto& line : lines)
+		{
+			rsx_log.success("%s", line);
+			std::fprintf(stdout, "%s\n", line.c_str());
+		}
+
+		std::fflush(stdout);
+	}
 }
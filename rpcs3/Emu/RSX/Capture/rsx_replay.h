@@ -11,7 +11,19 @@ namespace rsx
 	enum : u32
 	{
 		c_fc_magic = "RRC"_u32,
-		c_fc_version = 0x5,
+		c_fc_version = 0x6,
+	};
+
+	// File layout: header, compressed memory block chunks, then the serialized frame_capture_data
+	struct frame_capture_file_header
+	{
+		ENABLE_BITWISE_SERIALIZATION;
+
+		u32 magic;
+		u32 version;
+		u32 LE_format;
+		u32 reserved;
+		u64 metadata_offset;
 	};
 
 	struct frame_capture_data
@@ -21,6 +33,16 @@ namespace rsx
 			std::vector<u8> data{};
 		};
 
+		// location of a deduplicated memory block in the capture file, stored raw if both sizes match
+		struct memory_block_chunk
+		{
+			ENABLE_BITWISE_SERIALIZATION;
+
+			u64 file_offset;
+			u32 size;
+			u32 compressed_size;
+		};
+
 		// simple block to hold ps3 address and data
 		struct memory_block
 		{
@@ -97,7 +119,8 @@ namespace rsx
 		// hashmap of various memory 'changes' that can be applied to ps3 memory
 		std::unordered_map<u64, memory_block> memory_map;
 		// hashmap of memory blocks that can be applied, this is split from above for size decrease
-		std::unordered_map<u64, memory_block_data> memory_data_map;
+		// block contents are streamed from the capture file on demand
+		std::unordered_map<u64, memory_block_chunk> memory_data_map;
 		// display buffer state map
 		std::unordered_map<u64, display_buffers_state> display_buffers_map;
 		// actual command queue to hold everything above
@@ -111,6 +134,8 @@ namespace rsx
 			version = c_fc_version;
 			tile_map.clear();
 			memory_map.clear();
+			memory_data_map.clear();
+			display_buffers_map.clear();
 			replay_commands.clear();
 			reg_state = method_registers;
 		}
@@ -143,10 +168,23 @@ namespace rsx
 		current_state cs{};
 		std::unique_ptr<frame_capture_data> frame;
 
+		// Capture file holding the memory block chunks
+		fs::file data_file;
+
+		// Decompressed memory blocks, kept while under budget
+		std::unordered_map<u64, std::vector<u8>> block_cache;
+		usz block_cache_size{};
+		std::vector<u8> block_scratch;
+
+		// Number of replays to benchmark, 0 replays until stopped
+		u32 bench_iterations{};
+
 	public:
-		rsx_replay_thread(std::unique_ptr<frame_capture_data>&& frame_data)
+		rsx_replay_thread(std::unique_ptr<frame_capture_data>&& frame_data, fs::file&& capture_file, u32 bench_iterations = 0)
 			: cpu_thread(0)
 			, frame(std::move(frame_data))
+			, data_file(std::move(capture_file))
+			, bench_iterations(bench_iterations)
 		{
 		}
 
@@ -155,5 +193,7 @@ namespace rsx
 		be_t<u32> allocate_context();
 		std::vector<u32> alloc_write_fifo(be_t<u32> context_id) const;
 		void apply_frame_state(be_t<u32> context_id, const frame_capture_data::replay_command& replay_cmd);
+		void report_benchmark(const std::vector<u64>& iteration_times) const;
+		const std::vector<u8>& load_memory_block(u64 data_hash);
 	};
 }
@@ -31,6 +31,7 @@
 #define SSE4_1_FUNC
 #define AVX2_FUNC
 #define AVX3_FUNC
+#define AVX3_ICL_FUNC
 #else
 #ifndef __clang__
 #define PLAIN_FUNC __attribute__((optimize("no-tree-vectorize")))
@@ -40,6 +41,7 @@
 #define SSE4_1_FUNC __attribute__((__target__("sse4.1")))
 #define AVX2_FUNC __attribute__((__target__("avx2")))
 #define AVX3_FUNC __attribute__((__target__("avx512f,avx512bw,avx512dq,avx512cd,avx512vl")))
+#define AVX3_ICL_FUNC __attribute__((__target__("avx512f,avx512bw,avx512dq,avx512cd,avx512vl,avx512vbmi2")))
 #ifndef __AVX2__
 using __m256i = long long __attribute__((vector_size(32)));
 #endif
@@ -87,6 +89,13 @@ constexpr bool s_use_avx2 = false;
 constexpr bool s_use_avx3 = false;
 #endif
 
+#if defined(ARCH_X64)
+// VBMI2 is required for 16-bit compress, only checked at runtime
+const bool s_use_avx3_icl = s_use_avx3 && utils::has_avx512_icl();
+#else
+constexpr bool s_use_avx3_icl = false;
+#endif
+
 const __m128i s_bswap_u32_mask = _mm_set_epi8(
 	0xC, 0xD, 0xE, 0xF,
 	0x8, 0x9, 0xA, 0xB,
@@ -99,6 +108,41 @@ const __m128i s_bswap_u16_mask = _mm_set_epi8(
 	0x6, 0x7, 0x4, 0x5,
 	0x2, 0x3, 0x0, 0x1);
 
+// Shuffle masks packing the selected lanes of a 128-bit vector to the front (one entry per lane mask)
+template <typename T>
+constexpr auto make_compact_shuffle_lut()
+{
+	constexpr u32 lanes = 16 / sizeof(T);
+	std::array<std::array<u8, 16>, (1u << lanes)> result{};
+
+	for (u32 mask = 0; mask < (1u << lanes); ++mask)
+	{
+		u32 out = 0;
+		for (u32 lane = 0; lane < lanes; ++lane)
+		{
+			if (!(mask & (1u << lane)))
+			{
+				continue;
+			}
+
+			for (u32 byte = 0; byte < sizeof(T); ++byte)
+			{
+				result[mask][out++] = static_cast<u8>(lane * sizeof(T) + byte);
+			}
+		}
+
+		for (; out < 16; ++out)
+		{
+			result[mask][out] = 0x80;
+		}
+	}
+
+	return result;
+}
+
+alignas(16) constexpr auto s_compact_u16_lut = make_compact_shuffle_lut<u16>();
+alignas(16) constexpr auto s_compact_u32_lut = make_compact_shuffle_lut<u32>();
+
 namespace utils
 {
 	template <typename T, typename U>
@@ -707,6 +751,167 @@ namespace
 			return std::make_tuple(min_index, max_index);
 		}
 
+		// Compacting variants for disjointed primitives: restart indices are dropped instead of being replaced.
+		// Each iteration stores a full vector at the write cursor, which never overtakes the read cursor.
+#if defined(ARCH_X64)
+		AVX3_ICL_FUNC
+		static
+		std::tuple<u16, u16, u32> compact_u16_swapped_avx3(const void *src, void *dst, u32 iterations, u16 restart_index)
+		{
+			const __m512i s_bswap_u16_mask512 = _mm512_broadcast_i64x2(s_bswap_u16_mask);
+
+			auto src_stream = static_cast<const __m512i*>(src);
+			auto dst_stream = static_cast<u16*>(dst);
+
+			__m512i min = _mm512_set1_epi16(-1);
+			__m512i max = _mm512_set1_epi16(0);
+			const __m512i restart = _mm512_set1_epi16(restart_index);
+			u32 written = 0;
+
+			for (unsigned n = 0; n < iterations; ++n)
+			{
+				const __m512i raw = _mm512_loadu_si512(src_stream++);
+				const __m512i value = _mm512_shuffle_epi8(raw, s_bswap_u16_mask512);
+				const __mmask32 mask = _mm512_cmpneq_epi16_mask(restart, value);
+				max = _mm512_mask_max_epu16(max, mask, max, value);
+				min = _mm512_mask_min_epu16(min, mask, min, value);
+
+				// Full store of the compressed vector, compressstoreu is microcoded on some hosts
+				_mm512_storeu_si512(dst_stream + written, _mm512_maskz_compress_epi16(mask, value));
+				written += std::popcount(mask);
+			}
+
+			__m256i tmp256 = _mm512_extracti64x4_epi64(min, 1);
+			__m256i min2 = _mm512_castsi512_si256(min);
+			min2 = _mm256_min_epu16(min2, tmp256);
+			__m128i tmp = _mm256_extracti128_si256(min2, 1);
+			__m128i min3 = _mm256_castsi256_si128(min2);
+			min3 = _mm_min_epu16(min3, tmp);
+
+			tmp256 = _mm512_extracti64x4_epi64(max, 1);
+			__m256i max2 = _mm512_castsi512_si256(max);
+			max2 = _mm256_max_epu16(max2, tmp256);
+			tmp = _mm256_extracti128_si256(max2, 1);
+			__m128i max3 = _mm256_castsi256_si128(max2);
+			max3 = _mm_max_epu16(max3, tmp);
+
+			const u16 min_index = sse41_hmin_epu16(min3);
+			const u16 max_index = sse41_hmax_epu16(max3);
+
+			return std::make_tuple(min_index, max_index, written);
+		}
+
+		AVX3_FUNC
+		static
+		std::tuple<u32, u32, u32> compact_u32_swapped_avx3(const void *src, void *dst, u32 iterations, u32 restart_index)
+		{
+			const __m512i s_bswap_u32_mask512 = _mm512_broadcast_i64x2(s_bswap_u32_mask);
+
+			auto src_stream = static_cast<const __m512i*>(src);
+			auto dst_stream = static_cast<u32*>(dst);
+
+			__m512i min = _mm512_set1_epi32(-1);
+			__m512i max = _mm512_set1_epi32(0);
+			const __m512i restart = _mm512_set1_epi32(restart_index);
+			u32 written = 0;
+
+			for (unsigned n = 0; n < iterations; ++n)
+			{
+				const __m512i raw = _mm512_loadu_si512(src_stream++);
+				const __m512i value = _mm512_shuffle_epi8(raw, s_bswap_u32_mask512);
+				const __mmask16 mask = _mm512_cmpneq_epi32_mask(restart, value);
+				max = _mm512_mask_max_epu32(max, mask, max, value);
+				min = _mm512_mask_min_epu32(min, mask, min, value);
+
+				_mm512_storeu_si512(dst_stream + written, _mm512_maskz_compress_epi32(mask, value));
+				written += std::popcount(static_cast<u32>(mask));
+			}
+
+			const u32 min_index = _mm512_reduce_min_epu32(min);
+			const u32 max_index = _mm512_reduce_max_epu32(max);
+
+			return std::make_tuple(min_index, max_index, written);
+		}
+#endif
+
+		SSE4_1_FUNC
+		static
+		std::tuple<u16, u16, u32> compact_u16_swapped_sse4_1(const void *src, void *dst, u32 iterations, u16 restart_index)
+		{
+			auto src_stream = static_cast<const __m128i*>(src);
+			auto dst_stream = static_cast<u16*>(dst);
+
+			__m128i min = _mm_set1_epi16(-1);
+			__m128i max = _mm_set1_epi16(0);
+			const __m128i restart = _mm_set1_epi16(restart_index);
+			u32 written = 0;
+
+			for (unsigned n = 0; n < iterations; ++n)
+			{
+				const __m128i raw = _mm_loadu_si128(src_stream++);
+				const __m128i value = _mm_shuffle_epi8(raw, s_bswap_u16_mask);
+				const __m128i mask = _mm_cmpeq_epi16(restart, value);
+				const __m128i value_with_min_restart = _mm_andnot_si128(mask, value);
+				const __m128i value_with_max_restart = _mm_or_si128(mask, value);
+				max = _mm_max_epu16(max, value_with_min_restart);
+				min = _mm_min_epu16(min, value_with_max_restart);
+
+				const u32 keep = ~_mm_movemask_epi8(_mm_packs_epi16(mask, _mm_setzero_si128())) & 0xff;
+				const __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(s_compact_u16_lut[keep].data()));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst_stream + written), _mm_shuffle_epi8(value, shuffle));
+				written += std::popcount(keep);
+			}
+
+			const u16 min_index = sse41_hmin_epu16(min);
+			const u16 max_index = sse41_hmax_epu16(max);
+
+			return std::make_tuple(min_index, max_index, written);
+		}
+
+		SSE4_1_FUNC
+		static
+		std::tuple<u32, u32, u32> compact_u32_swapped_sse4_1(const void *src, void *dst, u32 iterations, u32 restart_index)
+		{
+			auto src_stream = static_cast<const __m128i*>(src);
+			auto dst_stream = static_cast<u32*>(dst);
+
+			__m128i min = _mm_set1_epi32(~0u);
+			__m128i max = _mm_set1_epi32(0);
+			const __m128i restart = _mm_set1_epi32(restart_index);
+			u32 written = 0;
+
+			for (unsigned n = 0; n < iterations; ++n)
+			{
+				const __m128i raw = _mm_loadu_si128(src_stream++);
+				const __m128i value = _mm_shuffle_epi8(raw, s_bswap_u32_mask);
+				const __m128i mask = _mm_cmpeq_epi32(restart, value);
+				const __m128i value_with_min_restart = _mm_andnot_si128(mask, value);
+				const __m128i value_with_max_restart = _mm_or_si128(mask, value);
+				max = _mm_max_epu32(max, value_with_min_restart);
+				min = _mm_min_epu32(min, value_with_max_restart);
+
+				const u32 keep = ~_mm_movemask_ps(_mm_castsi128_ps(mask)) & 0xf;
+				const __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(s_compact_u32_lut[keep].data()));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst_stream + written), _mm_shuffle_epi8(value, shuffle));
+				written += std::popcount(keep);
+			}
+
+			__m128i tmp = _mm_srli_si128(min, 8);
+			min = _mm_min_epu32(min, tmp);
+			tmp = _mm_srli_si128(min, 4);
+			min = _mm_min_epu32(min, tmp);
+
+			tmp = _mm_srli_si128(max, 8);
+			max = _mm_max_epu32(max, tmp);
+			tmp = _mm_srli_si128(max, 4);
+			max = _mm_max_epu32(max, tmp);
+
+			const u32 min_index = _mm_cvtsi128_si32(min);
+			const u32 max_index = _mm_cvtsi128_si32(max);
+
+			return std::make_tuple(min_index, max_index, written);
+		}
+
 		template<typename T>
 		static
 		std::tuple<T, T, u32> upload_untouched(std::span<to_be_t<const T>> src, std::span<T> dst, T restart_index, bool skip_restart)
@@ -714,9 +919,51 @@ namespace
 			T min_index = index_limit<T>();
 			T max_index = 0;
 			u32 written = 0;
+			u32 processed = 0;
 			u32 length = ::size32(src);
 
-			if (length >= 32 && !skip_restart)
+			if (length >= 32 && skip_restart)
+			{
+				if constexpr (std::is_same<T, u16>::value)
+				{
+					if (s_use_avx3_icl)
+					{
+#if defined(ARCH_X64)
+						const u32 iterations = length >> 5;
+						processed = length & ~0x1F;
+						std::tie(min_index, max_index, written) = compact_u16_swapped_avx3(src.data(), dst.data(), iterations, restart_index);
+#endif
+					}
+					else if (s_use_sse4_1)
+					{
+						const u32 iterations = length >> 3;
+						processed = length & ~0x7;
+						std::tie(min_index, max_index, written) = compact_u16_swapped_sse4_1(src.data(), dst.data(), iterations, restart_index);
+					}
+				}
+				else if constexpr (std::is_same<T, u32>::value)
+				{
+					if (s_use_avx3)
+					{
+#if defined(ARCH_X64)
+						const u32 iterations = length >> 4;
+						processed = length & ~0xF;
+						std::tie(min_index, max_index, written) = compact_u32_swapped_avx3(src.data(), dst.data(), iterations, restart_index);
+#endif
+					}
+					else if (s_use_sse4_1)
+					{
+						const u32 iterations = length >> 2;
+						processed = length & ~0x3;
+						std::tie(min_index, max_index, written) = compact_u32_swapped_sse4_1(src.data(), dst.data(), iterations, restart_index);
+					}
+				}
+				else
+				{
+					fmt::throw_exception("Unreachable");
+				}
+			}
+			else if (length >= 32)
 			{
 				if constexpr (std::is_same<T, u16>::value)
 				{
@@ -755,9 +1002,11 @@ namespace
 				{
 					fmt::throw_exception("Unreachable");
 				}
+
+				processed = written;
 			}
 
-			for (u32 i = written; i < length; ++i)
+			for (u32 i = processed; i < length; ++i)
 			{
 				T index = src[i];
 				if (index == restart_index)
@@ -965,27 +1214,73 @@ u32 get_index_type_size(rsx::index_array_type type)
 	fmt::throw_exception("Wrong index type");
 }
 
+namespace
+{
+	// Writes 'iterations' blocks of 24 indices, advancing each lane by its step after every block
+	void write_index_pattern_u16(u16* dst, unsigned iterations, const std::array<__m128i, 3>& base, const std::array<__m128i, 3>& step)
+	{
+		auto dst_stream = reinterpret_cast<__m128i*>(dst);
+		__m128i v0 = base[0], v1 = base[1], v2 = base[2];
+
+		for (unsigned n = 0; n < iterations; ++n)
+		{
+			_mm_storeu_si128(dst_stream++, v0);
+			_mm_storeu_si128(dst_stream++, v1);
+			_mm_storeu_si128(dst_stream++, v2);
+
+			v0 = _mm_add_epi16(v0, step[0]);
+			v1 = _mm_add_epi16(v1, step[1]);
+			v2 = _mm_add_epi16(v2, step[2]);
+		}
+	}
+}
+
 void write_index_array_for_non_indexed_non_native_primitive_to_buffer(char* dst, rsx::primitive_type draw_mode, unsigned count)
 {
 	auto typedDst = reinterpret_cast<u16*>(dst);
 	switch (draw_mode)
 	{
 	case rsx::primitive_type::line_loop:
-		for (unsigned i = 0; i < count; ++i)
+	{
+		// 24 sequential indices per block
+		const unsigned blocks = count / 24;
+		const __m128i step = _mm_set1_epi16(24);
+		write_index_pattern_u16(typedDst, blocks,
+			{ _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7), _mm_setr_epi16(8, 9, 10, 11, 12, 13, 14, 15), _mm_setr_epi16(16, 17, 18, 19, 20, 21, 22, 23) },
+			{ step, step, step });
+
+		for (unsigned i = blocks * 24; i < count; ++i)
 			typedDst[i] = i;
 		typedDst[count] = 0;
 		return;
+	}
 	case rsx::primitive_type::triangle_fan:
 	case rsx::primitive_type::polygon:
-		for (unsigned i = 0; i < (count - 2); i++)
+	{
+		// 8 triangles per block, the anchor lanes stay at 0
+		const unsigned blocks = (count - 2) / 8;
+		write_index_pattern_u16(typedDst, blocks,
+			{ _mm_setr_epi16(0, 1, 2, 0, 2, 3, 0, 3), _mm_setr_epi16(4, 0, 4, 5, 0, 5, 6, 0), _mm_setr_epi16(6, 7, 0, 7, 8, 0, 8, 9) },
+			{ _mm_setr_epi16(0, 8, 8, 0, 8, 8, 0, 8), _mm_setr_epi16(8, 0, 8, 8, 0, 8, 8, 0), _mm_setr_epi16(8, 8, 0, 8, 8, 0, 8, 8) });
+
+		for (unsigned i = blocks * 8; i < (count - 2); i++)
 		{
 			typedDst[3 * i] = 0;
 			typedDst[3 * i + 1] = i + 2 - 1;
 			typedDst[3 * i + 2] = i + 2;
 		}
 		return;
+	}
 	case rsx::primitive_type::quads:
-		for (unsigned i = 0; i < count / 4; i++)
+	{
+		// 4 quads (8 triangles) per block
+		const unsigned blocks = count / 16;
+		const __m128i step = _mm_set1_epi16(16);
+		write_index_pattern_u16(typedDst, blocks,
+			{ _mm_setr_epi16(0, 1, 2, 2, 3, 0, 4, 5), _mm_setr_epi16(6, 6, 7, 4, 8, 9, 10, 10), _mm_setr_epi16(11, 8, 12, 13, 14, 14, 15, 12) },
+			{ step, step, step });
+
+		for (unsigned i = blocks * 4; i < count / 4; i++)
 		{
 			// First triangle
 			typedDst[6 * i] = 4 * i;
@@ -997,6 +1292,7 @@ void write_index_array_for_non_indexed_non_native_primitive_to_buffer(char* dst,
 			typedDst[6 * i + 5] = 4 * i;
 		}
 		return;
+	}
 	case rsx::primitive_type::quad_strip:
 	case rsx::primitive_type::points:
 	case rsx::primitive_type::lines:
@@ -0,0 +1,171 @@
+#include "stdafx.h"
+#include "frame_time_recorder.h"
+
+#include "Emu/RSX/RSXThread.h"
+#include "Emu/IdManager.h"
+#include "Emu/perf_monitor.hpp"
+#include "Emu/System.h"
+#include "Emu/system_config.h"
+#include "Utilities/date_time.h"
+
+#include "util/cpu_stats.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace rsx
+{
+	// Pending CSV rows are written out in batches to keep file I/O off the per-frame path
+	constexpr usz frame_time_flush_threshold = 64 * 1024;
+
+	frame_time_recorder::frame_time_recorder() = default;
+
+	frame_time_recorder::~frame_time_recorder()
+	{
+		flush();
+	}
+
+	bool frame_time_recorder::enabled()
+	{
+		return g_cfg.video.frame_time_recording.get();
+	}
+
+	bool frame_time_recorder::open()
+	{
+		if (m_file)
+		{
+			return true;
+		}
+
+		if (m_open_failed)
+		{
+			return false;
+		}
+
+		const std::string dir_path = fs::get_cache_dir() + "telemetry/";
+		const std::string file_path = dir_path + Emu.GetTitleID() + "_frametimes_" + date_time::current_time_narrow() + ".csv";
+
+		if (!fs::create_path(dir_path) || !m_file.open(file_path, fs::rewrite))
+		{
+			rsx_log.error("Failed to create frame time recording %s (%s)", file_path, fs::g_tls_error);
+			m_open_failed = true;
+			return false;
+		}
+
+		rsx_log.notice("Recording frame times to %s", file_path);
+
+		m_pending = "frame,timestamp_us,frame_us,fifo_us,draw_us,flip_wait_us,present_us,cpu_pct,ppu_pct,spu_pct,rsx_pct\n";
+		m_cpu_stats = std::make_unique<utils::cpu_stats>();
+		return true;
+	}
+
+	void frame_time_recorder::flush()
+	{
+		if (m_file && !m_pending.empty())
+		{
+			m_file.write(m_pending);
+			m_pending.clear();
+		}
+	}
+
+	void frame_time_recorder::sample_utilization(u64 now_us)
+	{
+		if (now_us - m_last_sample_us < 1'000'000)
+		{
+			return;
+		}
+
+		m_last_sample_us = now_us;
+
+		const auto cycles = g_fxo->get<thread_cycle_sampler>().sample();
+		const u64 ppu_cycles = cycles.ppu_cycles - m_last_cycles.ppu_cycles;
+		const u64 spu_cycles = cycles.spu_cycles - m_last_cycles.spu_cycles;
+		const u64 rsx_cycles = cycles.rsx_cycles - m_last_cycles.rsx_cycles;
+		const f32 total_cycles = static_cast<f32>(std::max<u64>(1, ppu_cycles + spu_cycles + rsx_cycles));
+		m_last_cycles = cycles;
+
+		m_cpu_usage = static_cast<f32>(m_cpu_stats->get_usage());
+		m_ppu_usage = std::clamp(m_cpu_usage * ppu_cycles / total_cycles, 0.f, 100.f);
+		m_spu_usage = std::clamp(m_cpu_usage * spu_cycles / total_cycles, 0.f, 100.f);
+		m_rsx_usage = std::clamp(m_cpu_usage * rsx_cycles / total_cycles, 0.f, 100.f);
+	}
+
+	void frame_time_recorder::record(const frame_time_sample& sample)
+	{
+		if (!open())
+		{
+			return;
+		}
+
+		const u64 now = rsx::uclock();
+
+		if (!m_last_flip_us)
+		{
+			// The first flip only establishes the time base
+			m_last_flip_us = now;
+			return;
+		}
+
+		sample_utilization(now);
+
+		const u32 frame_us = static_cast<u32>(std::min<u64>(now - m_last_flip_us, u32{umax}));
+		m_last_flip_us = now;
+		m_frame_times.push_back(frame_us);
+
+		m_totals.fifo_us += sample.fifo_us;
+		m_totals.draw_us += sample.draw_us;
+		m_totals.flip_wait_us += sample.flip_wait_us;
+		m_totals.present_us += sample.present_us;
+
+		fmt::append(m_pending, "%u,%u,%u,%u,%u,%u,%u,%.1f,%.1f,%.1f,%.1f\n", m_frame_times.size(), now, frame_us,
+			sample.fifo_us, sample.draw_us, sample.flip_wait_us, sample.present_us, m_cpu_usage, m_ppu_usage, m_spu_usage, m_rsx_usage);
+
+		if (m_pending.size() >= frame_time_flush_threshold)
+		{
+			flush();
+		}
+	}
+
+	void frame_time_recorder::finish()
+	{
+		flush();
+
+		if (m_frame_times.empty())
+		{
+			return;
+		}
+
+		std::vector<u32> sorted = m_frame_times;
+		std::sort(sorted.begin(), sorted.end());
+
+		const usz count = sorted.size();
+		const f64 total_us = static_cast<f64>(std::accumulate(sorted.begin(), sorted.end(), u64{0}));
+
+		const auto percentile = [&](f64 p)
+		{
+			const usz index = std::min(count - 1, static_cast<usz>(p * static_cast<f64>(count) / 100.));
+			return sorted[index] / 1000.;
+		};
+
+		// 'X% low' is the average framerate of the slowest X% of frames
+		const auto low_fps = [&](f64 p)
+		{
+			const usz num = std::max<usz>(1, static_cast<usz>(static_cast<f64>(count) * p / 100.));
+			const f64 worst_us = static_cast<f64>(std::accumulate(sorted.end() - num, sorted.end(), u64{0}));
+			return worst_us ? (num * 1'000'000. / worst_us) : 0.;
+		};
+
+		const f64 frames = static_cast<f64>(count);
+
+		rsx_log.notice("Frame time report: %u frames, average %.2f fps (%.2f ms), 1%% low %.2f fps, 0.1%% low %.2f fps",
+			count, total_us ? (frames * 1'000'000. / total_us) : 0., total_us / frames / 1000., low_fps(1.), low_fps(0.1));
+		rsx_log.notice("Frame time percentiles: p50 %.2f ms, p90 %.2f ms, p99 %.2f ms, p99.9 %.2f ms, max %.2f ms",
+			percentile(50.), percentile(90.), percentile(99.), percentile(99.9), sorted.back() / 1000.);
+		rsx_log.notice("Frame phase averages: fifo %.2f ms, draw %.2f ms, flip wait %.2f ms, present %.2f ms",
+			m_totals.fifo_us / frames / 1000., m_totals.draw_us / frames / 1000., m_totals.flip_wait_us / frames / 1000., m_totals.present_us / frames / 1000.);
+
+		m_frame_times.clear();
+		m_totals = {};
+		m_last_flip_us = 0;
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "util/types.hpp"
+#include "Utilities/File.h"
+#include "Emu/perf_monitor.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace utils
+{
+	class cpu_stats;
+}
+
+namespace rsx
+{
+	// Phase breakdown of a single emulated frame, all values in microseconds
+	struct frame_time_sample
+	{
+		u64 fifo_us = 0;         // FIFO and method processing
+		u64 draw_us = 0;         // Draw setup, uploads and submission
+		u64 flip_wait_us = 0;    // Frame limiter delay before the flip
+		u64 present_us = 0;      // Backend flip and present
+	};
+
+	class frame_time_recorder
+	{
+		fs::file m_file;
+		std::string m_pending;
+		bool m_open_failed = false;
+
+		u64 m_last_flip_us = 0;
+		std::vector<u32> m_frame_times;
+
+		// Sums for the exit report
+		frame_time_sample m_totals{};
+
+		// Thread utilization, refreshed about once a second
+		std::unique_ptr<utils::cpu_stats> m_cpu_stats;
+		u64 m_last_sample_us = 0;
+		thread_cycle_sampler::totals m_last_cycles{};
+		f32 m_cpu_usage = 0.f;
+		f32 m_ppu_usage = 0.f;
+		f32 m_spu_usage = 0.f;
+		f32 m_rsx_usage = 0.f;
+
+		bool open();
+		void flush();
+		void sample_utilization(u64 now_us);
+
+	public:
+		frame_time_recorder();
+		~frame_time_recorder();
+
+		static bool enabled();
+
+		// Called once per emulated flip from the RSX thread
+		void record(const frame_time_sample& sample);
+
+		// Flushes the file and logs the percentile report
+		void finish();
+	};
+}
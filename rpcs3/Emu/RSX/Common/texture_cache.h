@@ -7,6 +7,8 @@
 #include <unordered_map>
 
 #include "Emu/Cell/timers.hpp"
+#include "util/sysinfo.hpp"
+#include "util/tsc.hpp"
 
 #define RSX_GCM_FORMAT_IGNORED 0
 
@@ -377,6 +379,15 @@ namespace rsx
 		atomic_t<u32> m_unavoidable_hard_faults_this_frame = { 0 };
 		atomic_t<u32> m_texture_upload_calls_this_frame = { 0 };
 		atomic_t<u32> m_texture_upload_misses_this_frame = { 0 };
+		atomic_t<u32> m_sections_created_this_frame = { 0 };
+		atomic_t<u32> m_sections_destroyed_this_frame = { 0 };
+		atomic_t<u32> m_invalidations_this_frame = { 0 };
+		atomic_t<u32> m_surface_lookups_this_frame = { 0 };
+		atomic_t<u64> m_bytes_uploaded_this_frame = { 0 };
+		atomic_t<u64> m_bytes_flushed_this_frame = { 0 };
+		atomic_t<u64> m_upload_ticks_this_frame = { 0 };
+		atomic_t<u64> m_flush_ticks_this_frame = { 0 };
+		atomic_t<u64> m_invalidate_ticks_this_frame = { 0 };
 		static const u32 m_predict_max_flushes_per_frame = 50; // Above this number the predictions are disabled
 
 		// Invalidation
@@ -396,6 +407,18 @@ namespace rsx
 			rsx::texture_upload_context context, rsx::texture_dimension_extended type, bool swizzled, component_order swizzle_flags, rsx::flags32_t flags) = 0;
 		virtual section_storage_type* upload_image_from_cpu(commandbuffer_type&, const address_range &rsx_range, u16 width, u16 height, u16 depth, u16 mipmaps, u32 pitch, u32 gcm_format, texture_upload_context context,
 			const std::vector<rsx::subresource_layout>& subresource_layout, rsx::texture_dimension_extended type, bool swizzled) = 0;
+
+		template <typename ...Args>
+		section_storage_type* upload_image_tracked(commandbuffer_type& cmd, const address_range& rsx_range, Args&&... args)
+		{
+			const u64 start = utils::get_tsc();
+			auto result = upload_image_from_cpu(cmd, rsx_range, std::forward<Args>(args)...);
+
+			m_bytes_uploaded_this_frame += rsx_range.length();
+			m_upload_ticks_this_frame += utils::get_tsc() - start;
+			return result;
+		}
+
 		virtual section_storage_type* create_nul_section(commandbuffer_type&, const address_range &rsx_range, bool memory_load) = 0;
 		virtual void set_component_order(section_storage_type& section, u32 gcm_format, component_order expected) = 0;
 		virtual void insert_texture_barrier(commandbuffer_type&, image_storage_type* tex, bool strong_ordering = true) = 0;
@@ -822,6 +845,17 @@ namespace rsx
 		template <typename ...Args>
 		thrashed_set invalidate_range_impl_base(commandbuffer_type& cmd, const address_range &fault_range_in, invalidation_cause cause, Args&&... extras)
 		{
+			const u64 start = utils::get_tsc();
+			auto result = invalidate_range_impl(cmd, fault_range_in, cause, std::forward<Args>(extras)...);
+
+			m_invalidations_this_frame++;
+			m_invalidate_ticks_this_frame += utils::get_tsc() - start;
+			return result;
+		}
+
+		template <typename ...Args>
+		thrashed_set invalidate_range_impl(commandbuffer_type& cmd, const address_range &fault_range_in, invalidation_cause cause, Args&&... extras)
+		{
 #ifdef TEXTURE_CACHE_DEBUG
 			// Check that the cache has the correct protections
 			tex_cache_checker.verify();
@@ -1738,6 +1772,7 @@ namespace rsx
 				// Fast lookup for cyclic reference
 				if (m_rtts.address_is_bound(attr.address)) [[unlikely]]
 				{
+					m_surface_lookups_this_frame++;
 					if (auto texptr = m_rtts.get_surface_at(attr.address);
 						helpers::check_framebuffer_resource(texptr, attr, extended_dimension))
 					{
@@ -1778,6 +1813,7 @@ namespace rsx
 				if (options.prefer_surface_cache)
 				{
 					const u16 block_h = (attr.depth * attr.slice_h);
+					m_surface_lookups_this_frame++;
 					overlapping_fbos = m_rtts.get_merged_texture_memory_region(cmd, attr.address, attr.width, block_h, attr.pitch, attr.bpp, rsx::surface_access::shader_read);
 
 					if (!overlapping_fbos.empty())
@@ -1843,6 +1879,7 @@ namespace rsx
 				{
 					// Now check for surface cache hits
 					const u16 block_h = (attr.depth * attr.slice_h);
+					m_surface_lookups_this_frame++;
 					overlapping_fbos = m_rtts.get_merged_texture_memory_region(cmd, attr.address, attr.width, block_h, attr.pitch, attr.bpp, rsx::surface_access::shader_read);
 				}
 
@@ -2304,7 +2341,7 @@ namespace rsx
 			invalidate_range_impl_base(cmd, tex_range, invalidation_cause::read, std::forward<Args>(extras)...);
 
 			// Upload from CPU. Note that sRGB conversion is handled in the FS
-			auto uploaded = upload_image_from_cpu(cmd, tex_range, attributes.width, attributes.height, attributes.depth, tex.get_exact_mipmap_count(), attributes.pitch, attributes.gcm_format,
+			auto uploaded = upload_image_tracked(cmd, tex_range, attributes.width, attributes.height, attributes.depth, tex.get_exact_mipmap_count(), attributes.pitch, attributes.gcm_format,
 				texture_upload_context::shader_read, subresources_layout, extended_dimension, attributes.swizzled);
 
 			return{ uploaded->get_view(tex.remap(), tex.decoded_remap()),
@@ -2396,6 +2433,7 @@ namespace rsx
 
 			auto rtt_lookup = [&m_rtts, &cmd, &scale_x, &scale_y, this](u32 address, u32 width, u32 height, u32 pitch, u8 bpp, rsx::flags32_t access, bool allow_clipped) -> typename surface_store_type::surface_overlap_info
 			{
+				m_surface_lookups_this_frame++;
 				const auto list = m_rtts.get_merged_texture_memory_region(cmd, address, width, height, pitch, bpp, access);
 				if (list.empty())
 				{
@@ -2922,7 +2960,7 @@ namespace rsx
 
 					invalidate_range_impl_base(cmd, rsx_range, invalidation_cause::read, std::forward<Args>(extras)...);
 
-					cached_src = upload_image_from_cpu(cmd, rsx_range, image_width, image_height, 1, 1, src.pitch, gcm_format, texture_upload_context::blit_engine_src,
+					cached_src = upload_image_tracked(cmd, rsx_range, image_width, image_height, 1, 1, src.pitch, gcm_format, texture_upload_context::blit_engine_src,
 						subresource_layout, rsx::texture_dimension_extended::texture_dimension_2d, dst.swizzled);
 
 					typeless_info.src_gcm_format = gcm_format;
@@ -3049,7 +3087,7 @@ namespace rsx
 						subres.data = { vm::get_super_ptr<const std::byte>(dst_base_address), static_cast<std::span<const std::byte>::size_type>(dst.pitch * dst_dimensions.height) };
 						subresource_layout.push_back(subres);
 
-						cached_dest = upload_image_from_cpu(cmd, rsx_range, dst_dimensions.width, dst_dimensions.height, 1, 1, dst.pitch,
+						cached_dest = upload_image_tracked(cmd, rsx_range, dst_dimensions.width, dst_dimensions.height, 1, 1, dst.pitch,
 							preferred_dst_format, rsx::texture_upload_context::blit_engine_dst, subresource_layout,
 							rsx::texture_dimension_extended::texture_dimension_2d, false);
 
@@ -3264,6 +3302,52 @@ namespace rsx
 			m_unavoidable_hard_faults_this_frame.store(0u);
 			m_texture_upload_calls_this_frame.store(0u);
 			m_texture_upload_misses_this_frame.store(0u);
+			m_sections_created_this_frame.store(0u);
+			m_sections_destroyed_this_frame.store(0u);
+			m_invalidations_this_frame.store(0u);
+			m_surface_lookups_this_frame.store(0u);
+			m_bytes_uploaded_this_frame.store(0u);
+			m_bytes_flushed_this_frame.store(0u);
+			m_upload_ticks_this_frame.store(0u);
+			m_flush_ticks_this_frame.store(0u);
+			m_invalidate_ticks_this_frame.store(0u);
+		}
+
+		void on_section_created()
+		{
+			m_sections_created_this_frame++;
+		}
+
+		void on_section_destroyed()
+		{
+			m_sections_destroyed_this_frame++;
+		}
+
+		void on_section_flushed(u32 bytes, u64 ticks)
+		{
+			m_bytes_flushed_this_frame += bytes;
+			m_flush_ticks_this_frame += ticks;
+		}
+
+		texture_cache_statistics get_frame_statistics() const
+		{
+			const u64 tsc_freq = std::max<u64>(utils::get_tsc_freq(), 1);
+
+			texture_cache_statistics stats{};
+			stats.sections_created = m_sections_created_this_frame;
+			stats.sections_destroyed = m_sections_destroyed_this_frame;
+			stats.flushes = m_flushes_this_frame;
+			stats.cache_misses = m_misses_this_frame;
+			stats.predictor_hits = m_speculations_this_frame;
+			stats.predictor_misses = m_predictor.m_mispredictions_this_frame;
+			stats.invalidations = m_invalidations_this_frame;
+			stats.surface_lookups = m_surface_lookups_this_frame;
+			stats.bytes_uploaded = m_bytes_uploaded_this_frame;
+			stats.bytes_flushed = m_bytes_flushed_this_frame;
+			stats.upload_time = static_cast<s64>(m_upload_ticks_this_frame * 1'000'000 / tsc_freq);
+			stats.flush_time = static_cast<s64>(m_flush_ticks_this_frame * 1'000'000 / tsc_freq);
+			stats.invalidate_time = static_cast<s64>(m_invalidate_ticks_this_frame * 1'000'000 / tsc_freq);
+			return stats;
 		}
 
 		void on_flush()
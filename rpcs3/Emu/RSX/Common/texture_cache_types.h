@@ -34,6 +34,24 @@ namespace rsx
 		flush_once = 1
 	};
 
+	// Per-frame texture cache activity, times are in microseconds
+	struct texture_cache_statistics
+	{
+		u32 sections_created;
+		u32 sections_destroyed;
+		u32 flushes;
+		u32 cache_misses;
+		u32 predictor_hits;
+		u32 predictor_misses;
+		u32 invalidations;
+		u32 surface_lookups;
+		u64 bytes_uploaded;
+		u64 bytes_flushed;
+		s64 upload_time;
+		s64 flush_time;
+		s64 invalidate_time;
+	};
+
 	struct invalidation_cause
 	{
 		enum enum_type
@@ -6,6 +6,7 @@
 
 #include "Emu/Memory/vm.h"
 #include "util/vm.hpp"
+#include "util/tsc.hpp"
 
 #include <list>
 #include <unordered_set>
@@ -304,6 +305,11 @@ namespace rsx
 
 		inline section_storage_type& create_section()
 		{
+			if (sections.empty())
+			{
+				m_storage->on_ranged_block_populated(*this);
+			}
+
 			auto &res = sections.emplace_back(this);
 			return res;
 		}
@@ -346,6 +352,15 @@ namespace rsx
 			return &get_storage()[index + 1];
 		}
 
+		// Next block holding any sections (or locked sections), skipping empty blocks
+		inline ranged_storage_block* next_populated_block(bool locked_only) const
+		{
+			if (is_last_block()) return nullptr;
+
+			const u32 next = get_storage().find_populated_block(index + 1, locked_only);
+			return next < num_blocks ? &get_storage()[next] : nullptr;
+		}
+
 		// Address range
 		inline const address_range& get_range() const { return range; }
 		inline u32 get_start() const { return range.start; }
@@ -361,7 +376,11 @@ namespace rsx
 		{
 			(void)section; // silence unused warning without _AUDIT
 			AUDIT(section.is_locked());
-			locked_count++;
+
+			if (locked_count++ == 0)
+			{
+				m_storage->on_ranged_block_first_section_locked(*this);
+			}
 		}
 
 		inline void on_section_unprotected(const section_storage_type &section)
@@ -370,6 +389,11 @@ namespace rsx
 			AUDIT(!section.is_locked());
 			u32 prev_locked = locked_count--;
 			ensure(prev_locked > 0);
+
+			if (prev_locked == 1)
+			{
+				m_storage->on_ranged_block_last_section_unlocked(*this);
+			}
 		}
 
 		inline void on_section_range_valid(section_storage_type &section)
@@ -471,9 +495,71 @@ namespace rsx
 		using block_type           = ranged_storage_block<ranged_storage>;
 
 	private:
+		// Two-level bitmap of block indices, lets range iteration jump straight to the next populated block
+		class block_bitmap
+		{
+			static constexpr u32 num_words = num_blocks / 64;
+			static_assert(num_words > 0 && num_words <= 64, "Summary word cannot cover all blocks");
+
+			std::array<u64, num_words> m_words{};
+			u64 m_summary = 0;
+
+		public:
+			void set(u32 index)
+			{
+				m_words[index / 64] |= (1ull << (index % 64));
+				m_summary |= (1ull << (index / 64));
+			}
+
+			void reset(u32 index)
+			{
+				if (!(m_words[index / 64] &= ~(1ull << (index % 64))))
+				{
+					m_summary &= ~(1ull << (index / 64));
+				}
+			}
+
+			void clear()
+			{
+				m_words = {};
+				m_summary = 0;
+			}
+
+			// Returns the first set index >= index, or umax if there are none
+			u32 find_next(u32 index) const
+			{
+				if (index >= num_blocks)
+				{
+					return umax;
+				}
+
+				u32 word = index / 64;
+				if (const u64 bits = m_words[word] & (~0ull << (index % 64)))
+				{
+					return word * 64 + std::countr_zero(bits);
+				}
+
+				if (++word >= num_words)
+				{
+					return umax;
+				}
+
+				const u64 summary = m_summary & (~0ull << word);
+				if (!summary)
+				{
+					return umax;
+				}
+
+				word = std::countr_zero(summary);
+				return word * 64 + std::countr_zero(m_words[word]);
+			}
+		};
+
 		block_type blocks[num_blocks];
 		texture_cache_type *m_tex_cache;
 		std::unordered_set<block_type*> m_in_use;
+		block_bitmap m_populated_blocks;
+		block_bitmap m_locked_blocks;
 		bool m_purging = false;
 
 	public:
@@ -536,6 +622,11 @@ namespace rsx
 			return *m_tex_cache;
 		}
 
+		inline u32 find_populated_block(u32 index, bool locked_only) const
+		{
+			return (locked_only ? m_locked_blocks : m_populated_blocks).find_next(index);
+		}
+
 
 		/**
 		 * Blocks
@@ -549,6 +640,8 @@ namespace rsx
 			}
 
 			m_in_use.clear();
+			m_populated_blocks.clear();
+			m_locked_blocks.clear();
 
 			AUDIT(m_unreleased_texture_objects == 0);
 			AUDIT(m_texture_memory_in_use == 0);
@@ -654,6 +747,7 @@ namespace rsx
 		void on_section_resources_created(const section_storage_type &section)
 		{
 			m_texture_memory_in_use += section.get_section_size();
+			m_tex_cache->on_section_created();
 		}
 
 		void on_section_resources_destroyed(const section_storage_type &section)
@@ -661,6 +755,7 @@ namespace rsx
 			u64 size = section.get_section_size();
 			u64 prev_size = m_texture_memory_in_use.fetch_sub(size);
 			ensure(prev_size >= size);
+			m_tex_cache->on_section_destroyed();
 		}
 
 		void on_ranged_block_first_section_created(block_type& block)
@@ -679,6 +774,21 @@ namespace rsx
 			m_in_use.erase(&block);
 		}
 
+		void on_ranged_block_populated(block_type& block)
+		{
+			m_populated_blocks.set(block.get_index());
+		}
+
+		void on_ranged_block_first_section_locked(block_type& block)
+		{
+			m_locked_blocks.set(block.get_index());
+		}
+
+		void on_ranged_block_last_section_unlocked(block_type& block)
+		{
+			m_locked_blocks.reset(block.get_index());
+		}
+
 		/**
 		 * Ranged Iterator
 		 */
@@ -781,21 +891,18 @@ namespace rsx
 
 					} while (true);
 
-					// Move to next block(s)
-					do
+					// Move to the next block with (locked) sections, empty blocks are skipped
+					block = block->next_populated_block(locked_only);
+					if (block == nullptr || block->get_start() > range.end) // Reached end
 					{
-						block = block->next_block();
-						if (block == nullptr || block->get_start() > range.end) // Reached end
-						{
-							block = nullptr;
-							obj = nullptr;
-							return;
-						}
+						block = nullptr;
+						obj = nullptr;
+						return;
+					}
 
-						needs_overlap_check = (block->get_end() > range.end);
-						cur_block_it = block->begin();
-						iterate = false;
-					} while (locked_only && block->get_locked_count() == 0); // find a block with locked sections
+					needs_overlap_check = (block->get_end() > range.end);
+					cur_block_it = block->begin();
+					iterate = false;
 
 				} while (true);
 			}
@@ -1640,7 +1747,9 @@ namespace rsx
 			ensure(synchronized);
 
 			// Copy flush result to guest memory
+			const u64 start = utils::get_tsc();
 			imp_flush();
+			m_tex_cache->on_section_flushed(get_section_size(), utils::get_tsc() - start);
 
 			// Finish up
 			// Its highly likely that this surface will be reused, so we just leave resources in place
@@ -5,6 +5,7 @@
 #include "GLCommonDecompiler.h"
 #include "../GCM.h"
 #include "../Program/GLSLCommon.h"
+#include "../Program/program_source_cache.h"
 
 std::string GLFragmentDecompilerThread::getFloatTypeName(usz elementCount)
 {
@@ -361,6 +362,24 @@ void GLFragmentProgram::Decompile(const RSXFragmentProgram& prog)
 		decompiler.device_props.has_low_precision_rounding = driver_caps.vendor_NVIDIA;
 	}
 
+	// Everything the decompiler reads from the driver caps, see insertHeader and insertGlobalFunctions
+	const auto& driver_caps = gl::get_driver_caps();
+	const u64 device_flags =
+		u64{decompiler.device_props.has_native_half_support} |
+		(u64{decompiler.device_props.has_low_precision_rounding} << 1) |
+		(u64{driver_caps.NV_gpu_shader5_supported} << 2) |
+		(u64{driver_caps.vendor_NVIDIA} << 3);
+	const u64 cache_key = rsx::program_source_cache::get_key(prog, device_flags);
+
+	if (rsx::program_source_cache::entry cached; rsx::g_program_source_cache.find(cache_key, cached))
+	{
+		FragmentConstantOffsetCache.assign(cached.metadata.begin(), cached.metadata.end());
+
+		shader.create(::glsl::program_domain::glsl_fragment_program, cached.source);
+		id = shader.id();
+		return;
+	}
+
 	decompiler.Task();
 
 	for (const ParamType& PT : decompiler.m_parr.params[PF_PARAM_UNIFORM])
@@ -378,6 +397,8 @@ void GLFragmentProgram::Decompile(const RSXFragmentProgram& prog)
 		}
 	}
 
+	rsx::g_program_source_cache.store(cache_key, { source, { FragmentConstantOffsetCache.begin(), FragmentConstantOffsetCache.end() } });
+
 	shader.create(::glsl::program_domain::glsl_fragment_program, source);
 	id = shader.id();
 }
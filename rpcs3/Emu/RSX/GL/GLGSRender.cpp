@@ -7,6 +7,7 @@
 #include "Emu/RSX/rsx_methods.h"
 
 #include "../Program/program_state_cache2.hpp"
+#include "../Program/program_source_cache.h"
 
 u64 GLGSRender::get_cycles()
 {
@@ -333,6 +334,9 @@ void GLGSRender::on_init_thread()
 
 	m_gl_texture_cache.initialize();
 
+	// Bump the version whenever the GLSL decompiler output changes
+	rsx::g_program_source_cache.open("opengl", 2);
+
 	m_prog_buffer.initialize
 	(
 		[this](void* const& props, const RSXVertexProgram& vp, const RSXFragmentProgram& fp)
@@ -373,6 +377,8 @@ void GLGSRender::on_exit()
 
 	gl::destroy_pipe_compiler();
 
+	rsx::g_program_source_cache.close();
+
 	m_prog_buffer.clear();
 	m_rtts.destroy();
 
@@ -998,6 +1004,11 @@ void GLGSRender::on_semaphore_acquire_wait()
 	}
 }
 
+rsx::texture_cache_statistics GLGSRender::get_texture_cache_statistics() const
+{
+	return m_gl_texture_cache.get_frame_statistics();
+}
+
 void GLGSRender::do_local_task(rsx::FIFO_state state)
 {
 	if (!work_queue.empty())
@@ -199,4 +199,6 @@ protected:
 	void on_invalidate_memory_range(const utils::address_range &range, rsx::invalidation_cause cause) override;
 	void notify_tile_unbound(u32 tile) override;
 	void on_semaphore_acquire_wait() override;
+
+	rsx::texture_cache_statistics get_texture_cache_statistics() const override;
 };
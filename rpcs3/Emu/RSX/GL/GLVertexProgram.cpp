@@ -5,6 +5,7 @@
 
 #include "GLCommonDecompiler.h"
 #include "../Program/GLSLCommon.h"
+#include "../Program/program_source_cache.h"
 
 #include <algorithm>
 
@@ -273,6 +274,25 @@ GLVertexProgram::~GLVertexProgram()
 
 void GLVertexProgram::Decompile(const RSXVertexProgram& prog)
 {
+	// Everything the decompiler reads from the driver caps, see insertMainStart
+	const auto& dev_caps = gl::get_driver_caps();
+	const u64 device_flags =
+		u64{dev_caps.NV_depth_buffer_float_supported} |
+		(u64{dev_caps.vendor_NVIDIA} << 1) |
+		(u64{dev_caps.vendor_INTEL} << 2);
+	const u64 cache_key = rsx::program_source_cache::get_key(prog, device_flags);
+
+	// Metadata layout: indexed constants flag followed by the constant ids
+	if (rsx::program_source_cache::entry cached; rsx::g_program_source_cache.find(cache_key, cached) && !cached.metadata.empty())
+	{
+		has_indexed_constants = !!cached.metadata[0];
+		constant_ids = std::vector<u16>(cached.metadata.begin() + 1, cached.metadata.end());
+
+		shader.create(::glsl::program_domain::glsl_vertex_program, cached.source);
+		id = shader.id();
+		return;
+	}
+
 	std::string source;
 	GLVertexDecompilerThread decompiler(prog, source, parr);
 	decompiler.Task();
@@ -280,6 +300,10 @@ void GLVertexProgram::Decompile(const RSXVertexProgram& prog)
 	has_indexed_constants = decompiler.properties.has_indexed_constants;
 	constant_ids = std::vector<u16>(decompiler.m_constant_ids.begin(), decompiler.m_constant_ids.end());
 
+	rsx::program_source_cache::entry data{ source, { u32{has_indexed_constants} } };
+	data.metadata.insert(data.metadata.end(), constant_ids.begin(), constant_ids.end());
+	rsx::g_program_source_cache.store(cache_key, data);
+
 	shader.create(::glsl::program_domain::glsl_vertex_program, source);
 	id = shader.id();
 }
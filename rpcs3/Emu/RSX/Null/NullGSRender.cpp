@@ -1,6 +1,9 @@
 #include "stdafx.h"
 #include "NullGSRender.h"
 
+#include "Emu/RSX/Common/BufferUtils.h"
+#include "Emu/RSX/Common/TextureUtils.h"
+
 u64 NullGSRender::get_cycles()
 {
 	return thread_ctrl::get_cycles(static_cast<named_thread<NullGSRender>&>(*this));
@@ -12,6 +15,159 @@ NullGSRender::NullGSRender(utils::serial* ar) noexcept : GSRender(ar)
 
 void NullGSRender::end()
 {
-	execute_nop_draw();
+	if (!g_cfg.video.frontend_profiling)
+	{
+		execute_nop_draw();
+		rsx::thread::end();
+		return;
+	}
+
+	// Do the same CPU work as a real backend so the frontend timings are representative
+	m_profiler.start();
+	analyse_current_rsx_pipeline();
+	m_frame_stats.setup_time += m_profiler.duration();
+
+	prepare_textures();
+	m_frame_stats.textures_upload_time += m_profiler.duration();
+
+	rsx::method_registers.current_draw_clause.begin();
+	do
+	{
+		rsx::method_registers.current_draw_clause.execute_pipeline_dependencies();
+		prepare_vertex_data();
+	}
+	while (rsx::method_registers.current_draw_clause.next());
+
+	m_frame_stats.vertex_upload_time += m_profiler.duration();
+
 	rsx::thread::end();
 }
+
+void NullGSRender::on_frame_end(u32 buffer, bool forced)
+{
+	m_prepared_textures.clear();
+	rsx::thread::on_frame_end(buffer, forced);
+}
+
+void NullGSRender::prepare_textures()
+{
+	rsx::texture_uploader_capabilities caps
+	{
+		.supports_byteswap = false,
+		.supports_vtc_decoding = false,
+		.supports_hw_deswizzle = false,
+		.supports_zero_copy = false,
+		.alignment = 4
+	};
+
+	auto prepare = [&](const auto& tex)
+	{
+		if (!tex.enabled())
+		{
+			return;
+		}
+
+		// Each texture is decoded once per frame, as a backend texture cache would
+		const u32 address = rsx::get_address(tex.offset(), tex.location());
+		const texture_key key{ address, tex.format(), tex.width(), tex.height() };
+
+		if (!m_prepared_textures.insert(key).second)
+		{
+			return;
+		}
+
+		const u32 format = tex.format() & ~(CELL_GCM_TEXTURE_LN | CELL_GCM_TEXTURE_UN);
+		const bool is_swizzled = !(tex.format() & CELL_GCM_TEXTURE_LN);
+
+		m_texture_scratch.resize(std::max<usz>(m_texture_scratch.size(), rsx::get_placed_texture_storage_size(tex, caps.alignment)));
+
+		for (const rsx::subresource_layout& layout : rsx::get_subresources_layout(tex))
+		{
+			rsx::upload_texture_subresource(m_texture_scratch, layout, format, is_swizzled, caps);
+			m_frame_stats.upload_bytes += layout.data.size();
+		}
+	};
+
+	for (u32 textures_ref = current_fp_metadata.referenced_textures_mask, i = 0; textures_ref; textures_ref >>= 1, ++i)
+	{
+		if (textures_ref & 1)
+		{
+			prepare(rsx::method_registers.fragment_textures[i]);
+		}
+	}
+
+	for (u32 textures_ref = current_vp_metadata.referenced_textures_mask, i = 0; textures_ref; textures_ref >>= 1, ++i)
+	{
+		if (textures_ref & 1)
+		{
+			prepare(rsx::method_registers.vertex_textures[i]);
+		}
+	}
+}
+
+void NullGSRender::prepare_vertex_data()
+{
+	analyse_inputs_interleaved(m_vertex_layout);
+
+	if (!m_vertex_layout.validate())
+	{
+		return;
+	}
+
+	const auto& draw_clause = rsx::method_registers.current_draw_clause;
+	const u32 element_count = draw_clause.get_elements_count();
+
+	u32 vertex_base = 0;
+	u32 vertex_count = 0;
+	u32 index_bytes = 0;
+
+	if (draw_clause.command == rsx::draw_command::indexed)
+	{
+		const rsx::index_array_type type = draw_clause.is_immediate_draw ? rsx::index_array_type::u32 : rsx::method_registers.index_type();
+		index_bytes = get_index_count(draw_clause.primitive, element_count) * get_index_type_size(type);
+		m_index_scratch.resize(std::max<usz>(m_index_scratch.size(), index_bytes));
+
+		const auto [min_index, max_index, index_count] = write_index_array_data_to_buffer(m_index_scratch, get_raw_index_array(draw_clause), type,
+			draw_clause.primitive, rsx::method_registers.restart_index_enabled(), rsx::method_registers.restart_index(),
+			[](auto prim) { return !is_primitive_native(prim); });
+
+		if (min_index >= max_index)
+		{
+			m_frame_stats.upload_bytes += index_bytes;
+			return;
+		}
+
+		vertex_base = rsx::get_index_from_base(min_index, rsx::method_registers.vertex_data_base_index());
+		vertex_count = (max_index - min_index) + 1;
+	}
+	else
+	{
+		if (draw_clause.command == rsx::draw_command::inlined_array)
+		{
+			if (m_vertex_layout.interleaved_blocks.empty() || !m_vertex_layout.interleaved_blocks[0].attribute_stride)
+			{
+				return;
+			}
+
+			vertex_count = ::size32(draw_clause.inline_vertex_array) * u32{sizeof(u32)} / m_vertex_layout.interleaved_blocks[0].attribute_stride;
+		}
+		else
+		{
+			vertex_base = draw_clause.min_index();
+			vertex_count = element_count;
+		}
+
+		if (!is_primitive_native(draw_clause.primitive))
+		{
+			index_bytes = get_index_count(draw_clause.primitive, vertex_count) * u32{sizeof(u16)};
+			m_index_scratch.resize(std::max<usz>(m_index_scratch.size(), index_bytes));
+			write_index_array_for_non_indexed_non_native_primitive_to_buffer(reinterpret_cast<char*>(m_index_scratch.data()), draw_clause.primitive, vertex_count);
+		}
+	}
+
+	const auto [persistent_size, volatile_size] = calculate_memory_requirements(m_vertex_layout, vertex_base, vertex_count);
+	m_vertex_scratch.resize(std::max<usz>(m_vertex_scratch.size(), persistent_size + volatile_size));
+
+	write_vertex_data_to_memory(m_vertex_layout, vertex_base, vertex_count, m_vertex_scratch.data(), m_vertex_scratch.data() + persistent_size);
+	m_frame_stats.upload_bytes += index_bytes + persistent_size + volatile_size;
+}
@@ -1,5 +1,8 @@
 #pragma once
 #include "Emu/RSX/GSRender.h"
+#include "util/fnv_hash.hpp"
+
+#include <unordered_set>
 
 class NullGSRender : public GSRender
 {
@@ -10,5 +13,34 @@ public:
 	NullGSRender() noexcept : NullGSRender(nullptr) {}
 
 private:
+	struct texture_key
+	{
+		u32 address;
+		u32 format;
+		u16 width;
+		u16 height;
+
+		bool operator==(const texture_key&) const = default;
+	};
+
+	struct texture_key_hash
+	{
+		usz operator()(const texture_key& key) const noexcept
+		{
+			return rpcs3::hash_struct(key);
+		}
+	};
+
 	void end() override;
+	void on_frame_end(u32 buffer, bool forced = false) override;
+
+	// CPU-side draw preparation, used when profiling the frontend
+	void prepare_textures();
+	void prepare_vertex_data();
+
+	rsx::vertex_input_layout m_vertex_layout = {};
+	std::vector<std::byte> m_index_scratch;
+	std::vector<std::byte> m_vertex_scratch;
+	std::vector<std::byte> m_texture_scratch;
+	std::unordered_set<texture_key, texture_key_hash> m_prepared_textures;
 };
@@ -286,6 +286,11 @@ namespace rsx
 
 		void overlay_element::set_padding(u16 left, u16 right, u16 top, u16 bottom)
 		{
+			if (padding_left == left && padding_right == right && padding_top == top && padding_bottom == bottom)
+			{
+				return;
+			}
+
 			padding_left = left;
 			padding_right = right;
 			padding_top = top;
@@ -317,12 +322,24 @@ namespace rsx
 
 		void overlay_element::set_text(const std::string& text)
 		{
-			this->text = utf8_to_u32string(text);
+			std::u32string new_text = utf8_to_u32string(text);
+			if (this->text == new_text)
+			{
+				return;
+			}
+
+			this->text = std::move(new_text);
 			is_compiled = false;
 		}
 
 		void overlay_element::set_unicode_text(const std::u32string& text)
 		{
+			// Unchanged text keeps the compiled vertices
+			if (this->text == text)
+			{
+				return;
+			}
+
 			this->text = text;
 			is_compiled = false;
 		}
@@ -334,18 +351,34 @@ namespace rsx
 
 		void overlay_element::set_font(const char* font_name, u16 font_size)
 		{
-			font_ref = fontmgr::get(font_name, font_size);
+			font* new_font = fontmgr::get(font_name, font_size);
+			if (font_ref == new_font)
+			{
+				return;
+			}
+
+			font_ref = new_font;
 			is_compiled = false;
 		}
 
 		void overlay_element::align_text(text_align align)
 		{
+			if (alignment == align)
+			{
+				return;
+			}
+
 			alignment = align;
 			is_compiled = false;
 		}
 
 		void overlay_element::set_wrap_text(bool state)
 		{
+			if (wrap_text == state)
+			{
+				return;
+			}
+
 			wrap_text = state;
 			is_compiled = false;
 		}
@@ -360,7 +393,7 @@ namespace rsx
 			auto renderer = get_font();
 
 			const u16 clip_width = clip_text ? w : umax;
-			std::vector<vertex> result = renderer->render_text(string, clip_width, wrap_text);
+			std::vector<vertex> result = renderer->render_text(string, clip_width, wrap_text, cache_text_layout);
 
 			if (!result.empty())
 			{
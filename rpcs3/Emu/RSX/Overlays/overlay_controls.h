@@ -142,6 +142,7 @@ namespace rsx
 			text_align alignment = left;
 			bool wrap_text = false;
 			bool clip_text = true;
+			bool cache_text_layout = true; // Disable for text that changes every frame
 
 			color4f back_color = { 0.f, 0.f, 0.f, 1.f };
 			color4f fore_color = { 1.f, 1.f, 1.f, 1.f };
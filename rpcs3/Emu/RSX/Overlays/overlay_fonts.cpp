@@ -176,57 +176,8 @@ namespace rsx
 			const auto fs_settings = get_glyph_files(class_);
 
 			// Attemt to load requested font
-			std::vector<u8> bytes;
-			std::string file_path;
-			bool font_found = false;
-
-			for (const auto& font_file : fs_settings.font_names)
-			{
-				if (fs::is_file(font_file))
-				{
-					// Check for absolute paths or fonts 'installed' to executable folder
-					file_path = font_file;
-					font_found = true;
-					break;
-				}
-
-				std::string extension;
-				if (const auto extension_start = font_file.find_last_of('.');
-					extension_start != umax)
-				{
-					extension = font_file.substr(extension_start + 1);
-				}
-
-				std::string file_name = font_file;
-				if (extension.length() != 3)
-				{
-					// Allow other extensions to support other truetype formats
-					file_name += ".ttf";
-				}
-
-				for (const auto& font_dir : fs_settings.lookup_font_dirs)
-				{
-					file_path = font_dir + file_name;
-					if (fs::is_file(file_path))
-					{
-						font_found = true;
-						break;
-					}
-				}
-
-				if (font_found)
-				{
-					break;
-				}
-			}
-
-			// Read font
-			if (font_found)
-			{
-				fs::file f(file_path);
-				f.read(bytes, f.size());
-			}
-			else
+			const auto bytes = fontmgr::get_font_file(fs_settings, fmt::format("%s:%d", font_name, static_cast<int>(class_)));
+			if (!bytes)
 			{
 				rsx_log.error("Failed to initialize font '%s.ttf' on codepage %d", font_name, static_cast<u32>(codepage_id));
 				return nullptr;
@@ -234,7 +185,7 @@ namespace rsx
 
 			codepage_cache.page = nullptr;
 			auto page = std::make_unique<codepage>();
-			page->initialize_glyphs(codepage_id, size_px, bytes);
+			page->initialize_glyphs(codepage_id, size_px, *bytes);
 			page->sampler_z = static_cast<f32>(m_glyph_map.size());
 
 			auto ret = page.get();
@@ -398,12 +349,57 @@ namespace rsx
 			}
 		}
 
-		std::vector<vertex> font::render_text(const char32_t* text, u16 max_width, bool wrap)
+		std::vector<vertex> font::render_text(const char32_t* text, u16 max_width, bool wrap, bool cache_layout)
 		{
 			std::vector<vertex> result;
 			f32 unused_x, unused_y;
 
+			if (!cache_layout)
+			{
+				render_text_ex(result, unused_x, unused_y, text, -1, max_width, wrap);
+				return result;
+			}
+
+			const std::u32string_view str(text);
+			const u64 key = std::hash<std::u32string_view>{}(str) ^ (u64{max_width} << 1) ^ u64{wrap};
+
+			{
+				std::lock_guard lock(m_layout_cache_lock);
+
+				for (auto [it, end] = m_layout_cache.equal_range(key); it != end; ++it)
+				{
+					const auto& layout = *it->second;
+					if (layout.max_width == max_width && layout.wrap == wrap && layout.text == str)
+					{
+						m_layout_lru.splice(m_layout_lru.begin(), m_layout_lru, it->second);
+						return layout.verts;
+					}
+				}
+			}
+
 			render_text_ex(result, unused_x, unused_y, text, -1, max_width, wrap);
+
+			std::lock_guard lock(m_layout_cache_lock);
+
+			if (m_layout_lru.size() >= max_cached_layouts)
+			{
+				// Evict the least recently used layout
+				const auto oldest = std::prev(m_layout_lru.end());
+
+				for (auto [it, end] = m_layout_cache.equal_range(oldest->key); it != end; ++it)
+				{
+					if (it->second == oldest)
+					{
+						m_layout_cache.erase(it);
+						break;
+					}
+				}
+
+				m_layout_lru.erase(oldest);
+			}
+
+			m_layout_lru.push_front(text_layout{ key, std::u32string(str), max_width, wrap, result });
+			m_layout_cache.emplace(key, m_layout_lru.begin());
 			return result;
 		}
 
@@ -416,6 +412,87 @@ namespace rsx
 			return {loc_x, loc_y};
 		}
 
+		std::shared_ptr<const std::vector<u8>> fontmgr::get_font_file(const glyph_load_setup& setup, const std::string& cache_key)
+		{
+			if (m_instance == nullptr)
+				m_instance = new fontmgr;
+
+			auto& mgr = *m_instance;
+
+			{
+				reader_lock lock(mgr.m_file_cache_lock);
+
+				if (auto found = mgr.m_file_cache.find(cache_key); found != mgr.m_file_cache.end())
+				{
+					return found->second;
+				}
+			}
+
+			std::string file_path;
+			bool font_found = false;
+
+			for (const auto& font_file : setup.font_names)
+			{
+				if (fs::is_file(font_file))
+				{
+					// Check for absolute paths or fonts 'installed' to executable folder
+					file_path = font_file;
+					font_found = true;
+					break;
+				}
+
+				std::string extension;
+				if (const auto extension_start = font_file.find_last_of('.');
+					extension_start != umax)
+				{
+					extension = font_file.substr(extension_start + 1);
+				}
+
+				std::string file_name = font_file;
+				if (extension.length() != 3)
+				{
+					// Allow other extensions to support other truetype formats
+					file_name += ".ttf";
+				}
+
+				for (const auto& font_dir : setup.lookup_font_dirs)
+				{
+					file_path = font_dir + file_name;
+					if (fs::is_file(file_path))
+					{
+						font_found = true;
+						break;
+					}
+				}
+
+				if (font_found)
+				{
+					break;
+				}
+			}
+
+			if (!font_found)
+			{
+				return nullptr;
+			}
+
+			std::lock_guard lock(mgr.m_file_cache_lock);
+
+			// Different font names can resolve to the same fallback file
+			if (auto found = mgr.m_file_cache.find(file_path); found != mgr.m_file_cache.end())
+			{
+				return mgr.m_file_cache[cache_key] = found->second;
+			}
+
+			auto bytes = std::make_shared<std::vector<u8>>();
+			fs::file f(file_path);
+			f.read(*bytes, f.size());
+
+			mgr.m_file_cache[file_path] = bytes;
+			mgr.m_file_cache[cache_key] = bytes;
+			return bytes;
+		}
+
 		void font::get_glyph_data(std::vector<u8>& bytes) const
 		{
 			const u32 page_size = codepage::bitmap_width * codepage::bitmap_height;
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "util/types.hpp"
+#include "Utilities/mutex.h"
 #include "overlay_utils.h"
 
+#include <list>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 // STB_IMAGE_IMPLEMENTATION and STB_TRUETYPE_IMPLEMENTATION defined externally
@@ -64,6 +68,22 @@ namespace rsx
 			}
 			codepage_cache;
 
+			// Memoized output of render_text, keyed by the text and layout parameters
+			struct text_layout
+			{
+				u64 key = 0;
+				std::u32string text;
+				u16 max_width = 0;
+				bool wrap = false;
+				std::vector<vertex> verts;
+			};
+
+			static constexpr usz max_cached_layouts = 256;
+
+			std::list<text_layout> m_layout_lru; // Most recently used first
+			std::unordered_multimap<u64, std::list<text_layout>::iterator> m_layout_cache;
+			shared_mutex m_layout_cache_lock;
+
 			static language_class classify(char32_t codepage_id);
 			glyph_load_setup get_glyph_files(language_class class_) const;
 			codepage* initialize_codepage(char32_t codepage_id);
@@ -75,7 +95,7 @@ namespace rsx
 
 			void render_text_ex(std::vector<vertex>& result, f32& x_advance, f32& y_advance, const char32_t* text, usz char_limit, u16 max_width, bool wrap);
 
-			std::vector<vertex> render_text(const char32_t* text, u16 max_width = -1, bool wrap = false);
+			std::vector<vertex> render_text(const char32_t* text, u16 max_width = -1, bool wrap = false, bool cache_layout = true);
 
 			std::pair<f32, f32> get_char_offset(const char32_t* text, usz max_length, u16 max_width = -1, bool wrap = false);
 
@@ -97,6 +117,10 @@ namespace rsx
 			std::vector<std::unique_ptr<font>> fonts;
 			static fontmgr* m_instance;
 
+			// TTF files are shared by every size of a font, only the packed glyph pages are size specific
+			std::unordered_map<std::string, std::shared_ptr<const std::vector<u8>>> m_file_cache;
+			shared_mutex m_file_cache_lock;
+
 			font* find(const char* name, int size)
 			{
 				for (auto& f : fonts)
@@ -128,6 +152,9 @@ namespace rsx
 
 				return m_instance->find(name, size);
 			}
+
+			// Resolves and loads a font file once, returns null if none of the candidates exist
+			static std::shared_ptr<const std::vector<u8>> get_font_file(const glyph_load_setup& setup, const std::string& cache_key);
 		};
 	}
 }
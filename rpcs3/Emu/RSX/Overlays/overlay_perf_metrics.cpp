@@ -3,6 +3,8 @@
 #include "Emu/RSX/RSXThread.h"
 #include "Emu/Cell/SPUThread.h"
 #include "Emu/Cell/PPUThread.h"
+#include "Emu/Cell/Modules/cellAudio.h"
+#include "Emu/perf_monitor.hpp"
 
 #include <algorithm>
 #include <utility>
@@ -220,6 +222,7 @@ namespace rsx
 		void perf_metrics_overlay::reset_body()
 		{
 			m_body.set_font(m_font.c_str(), m_font_size);
+			m_body.cache_text_layout = false; // Refreshed with new values every frame
 			m_body.fore_color = convert_color_code(m_color_body, m_opacity);
 			m_body.back_color = convert_color_code(m_background_body, m_opacity);
 			reset_transform(m_body);
@@ -476,21 +479,31 @@ namespace rsx
 
 						m_total_threads = utils::cpu_stats::get_current_thread_count();
 
+						if (const auto audio = g_fxo->try_get<cell_audio>(); audio && audio->m_buffer_stats.target_us)
+						{
+							const auto& stats = audio->m_buffer_stats;
+							m_audio_buffered = stats.enqueued_us / 1000.f;
+							m_audio_target = stats.target_us / 1000.f;
+							m_audio_jitter = stats.jitter_us / 1000.f;
+							m_audio_underruns = stats.underruns;
+							m_audio_overruns = stats.overruns;
+						}
+						else
+						{
+							m_audio_buffered = -1.f;
+						}
+
 						[[fallthrough]];
 					}
 					case detail_level::medium:
 					{
-						m_ppus = idm::select<named_thread<ppu_thread>>([this](u32, named_thread<ppu_thread>& ppu)
-						{
-							m_ppu_cycles += thread_ctrl::get_cycles(ppu);
-						});
+						const auto cycles = g_fxo->get<thread_cycle_sampler>().sample();
 
-						m_spus = idm::select<named_thread<spu_thread>>([this](u32, named_thread<spu_thread>& spu)
-						{
-							m_spu_cycles += thread_ctrl::get_cycles(spu);
-						});
-
-						m_rsx_cycles += rsx_thread.get_cycles();
+						m_ppus = cycles.ppu_count;
+						m_spus = cycles.spu_count;
+						m_ppu_cycles = cycles.ppu_cycles;
+						m_spu_cycles = cycles.spu_cycles;
+						m_rsx_cycles = cycles.rsx_cycles;
 
 						m_total_cycles = std::max<u64>(1, m_ppu_cycles + m_spu_cycles + m_rsx_cycles);
 						m_cpu_usage    = static_cast<f32>(m_cpu_stats.get_usage());
@@ -568,6 +581,12 @@ namespace rsx
 					                         "%s\n"
 					                         " RSX   : %02u %%",
 					    m_fps, m_frametime, std::string(title1_high.size(), ' '), m_ppu_usage, m_ppus, m_spu_usage, m_spus, m_rsx_usage, m_cpu_usage, m_total_threads, std::string(title2.size(), ' '), m_rsx_load);
+
+					if (m_audio_buffered >= 0.f)
+					{
+						fmt::append(perf_text, "\n Audio : %04.1fms / %04.1fms (jitter %03.1fms)\n         %u underruns, %u overruns",
+						    m_audio_buffered, m_audio_target, m_audio_jitter, m_audio_underruns, m_audio_overruns);
+					}
 					break;
 				}
 				}
@@ -638,6 +657,7 @@ namespace rsx
 		graph::graph()
 		{
 			m_label.set_font("e046323ms.ttf", 8);
+			m_label.cache_text_layout = false; // Refreshed with new values every frame
 			m_label.fore_color = { 1.f, 1.f, 1.f, 1.f };
 			m_label.back_color = { 0.f, 0.f, 0.f, .7f };
 
@@ -812,8 +832,10 @@ namespace rsx
 			m_label.set_text(fps_info);
 			m_label.set_padding(4, 4, 0, 4);
 
-			m_label.auto_resize();
-			m_label.refresh();
+			if (m_label.auto_resize())
+			{
+				m_label.refresh();
+			}
 
 			// If label horizontal end is larger, widen graph width to match it
 			set_size(std::max(m_label.w, w), h);
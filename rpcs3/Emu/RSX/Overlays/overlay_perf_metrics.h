@@ -78,6 +78,12 @@ namespace rsx
 			f32 m_rsx_usage{0};
 			u32 m_rsx_load{0};
 
+			f32 m_audio_buffered{-1.f}; // ms, negative when cellAudio is not buffering
+			f32 m_audio_target{0};
+			f32 m_audio_jitter{0};
+			u64 m_audio_underruns{0};
+			u64 m_audio_overruns{0};
+
 			void reset_transform(label& elm) const;
 			void reset_transforms();
 			void reset_body();
@@ -151,9 +151,16 @@ protected:
 
 	binary_to_vertex_program m_vertex_shader_cache;
 	binary_to_fragment_program m_fragment_shader_cache;
-	std::unordered_map<pipeline_key, pipeline_storage_type, pipeline_key_hash, pipeline_key_compare> m_storage;
+	struct pipeline_entry
+	{
+		pipeline_storage_type pipeline;
+		atomic_t<bool> unused_preload = false; // Preloaded from the disk cache and not used by the title yet
+	};
+
+	std::unordered_map<pipeline_key, pipeline_entry, pipeline_key_hash, pipeline_key_compare> m_storage;
+	atomic_t<u32> m_unused_preload_count = 0;
 
-	decompiler_callback_t notify_pipeline_compiled;
+	decompiler_callback_t notify_pipeline_compiled; // Also invoked on the first use of a pipeline preloaded from the disk cache
 
 	vertex_program_type __null_vertex_program;
 	fragment_program_type __null_fragment_program;
@@ -335,8 +342,20 @@ public:
 			reader_lock lock(m_pipeline_mutex);
 			if (const auto I = m_storage.find(key); I != m_storage.end())
 			{
-				m_cache_miss_flag = (I->second == __null_pipeline_handle);
-				return { I->second.get(), &vertex_program, &fragment_program };
+				m_cache_miss_flag = (I->second.pipeline == __null_pipeline_handle);
+
+				if (allow_notification && m_unused_preload_count && I->second.unused_preload.exchange(false)) [[unlikely]]
+				{
+					// First use of a preloaded pipeline, report it back to the disk cache
+					m_unused_preload_count--;
+
+					if (notify_pipeline_compiled)
+					{
+						notify_pipeline_compiled(key.properties, vertexShader, fragmentShader);
+					}
+				}
+
+				return { I->second.pipeline.get(), &vertex_program, &fragment_program };
 			}
 		}
 
@@ -346,12 +365,20 @@ public:
 			// Check if another submission completed in the mean time
 			if (const auto I = m_storage.find(key); I != m_storage.end())
 			{
-				m_cache_miss_flag = (I->second == __null_pipeline_handle);
-				return { I->second.get(), &vertex_program, &fragment_program };
+				m_cache_miss_flag = (I->second.pipeline == __null_pipeline_handle);
+				return { I->second.pipeline.get(), &vertex_program, &fragment_program };
 			}
 
 			// Insert a placeholder if the key still doesn't exist to avoid re-linking of the same pipeline
-			m_storage[key] = std::move(__null_pipeline_handle);
+			auto& entry = m_storage[key];
+			entry.pipeline = std::move(__null_pipeline_handle);
+
+			if (!allow_notification)
+			{
+				// Preloaded from the disk cache, reported back once the title actually uses it
+				entry.unused_preload = true;
+				m_unused_preload_count++;
+			}
 		}
 
 		rsx_log.notice("Add program (vp id = %d, fp id = %d)", vertex_program.id, fragment_program.id);
@@ -372,7 +399,7 @@ public:
 				notify_pipeline_compiled(key.properties, vertexShader, fragmentShader_);
 
 				std::lock_guard lock(m_pipeline_mutex);
-				auto& pipe_result = m_storage[key];
+				auto& pipe_result = m_storage[key].pipeline;
 				pipe_result = std::move(pipeline);
 				return pipe_result.get();
 			};
@@ -387,7 +414,7 @@ public:
 				}
 
 				std::lock_guard lock(m_pipeline_mutex);
-				auto& pipe_result = m_storage[key];
+				auto& pipe_result = m_storage[key].pipeline;
 				pipe_result = std::move(pipeline);
 				return pipe_result.get();
 			};
@@ -414,5 +441,6 @@ public:
 		m_fragment_shader_cache.clear();
 		m_vertex_shader_cache.clear();
 		m_storage.clear();
+		m_unused_preload_count = 0;
 	}
 };
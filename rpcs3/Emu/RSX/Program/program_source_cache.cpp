@@ -0,0 +1,189 @@
+#include "stdafx.h"
+#include "program_source_cache.h"
+#include "ProgramStateCache.h"
+
+#include "Emu/cache_utils.hpp"
+#include "Emu/system_config.h"
+
+#include "xxhash.h"
+
+namespace rsx
+{
+	program_source_cache g_program_source_cache;
+
+	struct source_cache_header
+	{
+		u32 magic;
+		u32 version;
+	};
+
+	constexpr u32 c_source_cache_magic = "RPDS"_u32;
+
+	void program_source_cache::open(const std::string& backend_name, u32 version)
+	{
+		close();
+
+		if (g_cfg.video.disable_on_disk_shader_cache)
+		{
+			return;
+		}
+
+		const std::string cache_path = rpcs3::cache::get_ppu_cache();
+		if (cache_path.empty())
+		{
+			return;
+		}
+
+		const std::string directory_path = cache_path + "shaders_cache/sources/";
+		const std::string file_path = directory_path + backend_name + ".bin";
+		fs::create_path(directory_path);
+
+		std::lock_guard lock(m_mutex);
+
+		if (!m_file.open(file_path, fs::read + fs::write + fs::create))
+		{
+			rsx_log.error("Failed to open shader source cache %s (%s)", file_path, fs::g_tls_error);
+			return;
+		}
+
+		source_cache_header header{};
+		if (!m_file.read(header) || header.magic != c_source_cache_magic || header.version != version)
+		{
+			// Created, incompatible or outdated, start over
+			header = { c_source_cache_magic, version };
+			m_file.trunc(0);
+			m_file.seek(0);
+			m_file.write(header);
+			return;
+		}
+
+		// Index the records, a partially written trailing record is discarded
+		const u64 file_size = m_file.size();
+		u64 offset = sizeof(source_cache_header);
+
+		for (record rec{}; offset + sizeof(record) <= file_size && m_file.seek(offset) == offset && m_file.read(rec);)
+		{
+			const u64 record_size = sizeof(record) + rec.source_length + u64{rec.metadata_count} * sizeof(u32);
+			if (offset + record_size > file_size)
+			{
+				break;
+			}
+
+			m_index[rec.key] = offset;
+			offset += record_size;
+		}
+
+		m_file.trunc(offset);
+
+		rsx_log.notice("Shader source cache: %u entries loaded from %s", m_index.size(), file_path);
+	}
+
+	void program_source_cache::close()
+	{
+		std::lock_guard lock(m_mutex);
+
+		if (m_file && (m_hits || m_misses))
+		{
+			rsx_log.notice("Shader source cache: %u hits, %u misses", m_hits, m_misses);
+		}
+
+		m_file.close();
+		m_index.clear();
+		m_hits = 0;
+		m_misses = 0;
+	}
+
+	bool program_source_cache::find(u64 key, entry& result)
+	{
+		// Reads move the file pointer, a shared lock is not enough
+		std::lock_guard lock(m_mutex);
+
+		if (!m_file)
+		{
+			return false;
+		}
+
+		const auto found = m_index.find(key);
+		if (found == m_index.end())
+		{
+			m_misses++;
+			return false;
+		}
+
+		record rec{};
+		m_file.seek(found->second);
+
+		if (!m_file.read(rec) || rec.key != key)
+		{
+			m_misses++;
+			return false;
+		}
+
+		result.source.resize(rec.source_length);
+		result.metadata.resize(rec.metadata_count);
+
+		if (m_file.read(result.source.data(), rec.source_length) != rec.source_length ||
+			m_file.read(result.metadata.data(), rec.metadata_count * sizeof(u32)) != rec.metadata_count * sizeof(u32))
+		{
+			m_misses++;
+			return false;
+		}
+
+		m_hits++;
+		return true;
+	}
+
+	void program_source_cache::store(u64 key, const entry& data)
+	{
+		std::lock_guard lock(m_mutex);
+
+		if (!m_file || m_index.contains(key))
+		{
+			return;
+		}
+
+		const record rec{ key, ::size32(data.source), ::size32(data.metadata) };
+		const u64 offset = m_file.seek(0, fs::seek_end);
+
+		m_file.write(rec);
+		m_file.write(data.source.data(), data.source.size());
+		m_file.write(data.metadata.data(), data.metadata.size() * sizeof(u32));
+
+		m_index[key] = offset;
+	}
+
+	u64 program_source_cache::get_key(const RSXVertexProgram& prog, u64 device_flags)
+	{
+		std::vector<u64> key_data =
+		{
+			program_hash_util::vertex_program_utils::get_vertex_program_ucode_hash(prog),
+			prog.output_mask,
+			prog.texture_state.texture_dimensions,
+			prog.texture_state.multisampled_textures,
+			prog.base_address,
+			prog.entry,
+			device_flags
+		};
+
+		key_data.insert(key_data.end(), prog.jump_table.begin(), prog.jump_table.end());
+		return XXH64(key_data.data(), key_data.size() * sizeof(u64), 0);
+	}
+
+	u64 program_source_cache::get_key(const RSXFragmentProgram& prog, u64 device_flags)
+	{
+		const u64 key_data[] =
+		{
+			program_hash_util::fragment_program_utils::get_fragment_program_ucode_hash(prog),
+			prog.ctrl,
+			prog.two_sided_lighting,
+			prog.texcoord_control_mask,
+			prog.texture_state.texture_dimensions,
+			prog.texture_state.shadow_textures,
+			prog.texture_state.redirected_textures,
+			prog.texture_state.multisampled_textures,
+			device_flags
+		};
+
+		return XXH64(key_data, sizeof(key_data), 0);
+	}
+}
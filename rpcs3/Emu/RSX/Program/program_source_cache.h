@@ -0,0 +1,53 @@
+#pragma once
+
+#include "util/types.hpp"
+#include "Utilities/File.h"
+#include "Utilities/mutex.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct RSXVertexProgram;
+struct RSXFragmentProgram;
+
+namespace rsx
+{
+	// Persistent cache of decompiled shader sources.
+	// Entries are keyed by the program ucode hash combined with the program state and device flags the decompiler depends on.
+	class program_source_cache
+	{
+	public:
+		struct entry
+		{
+			std::string source;
+			std::vector<u32> metadata; // Backend defined, e.g. constant offsets
+		};
+
+		// Open the cache of the current title for the given backend, version must change whenever the decompiler output does
+		void open(const std::string& backend_name, u32 version);
+		void close();
+
+		bool find(u64 key, entry& result);
+		void store(u64 key, const entry& data);
+
+		static u64 get_key(const RSXVertexProgram& prog, u64 device_flags);
+		static u64 get_key(const RSXFragmentProgram& prog, u64 device_flags);
+
+	private:
+		struct record
+		{
+			u64 key;
+			u32 source_length;
+			u32 metadata_count;
+		};
+
+		shared_mutex m_mutex;
+		fs::file m_file;
+		std::unordered_map<u64, u64> m_index; // key -> record offset
+		u32 m_hits = 0;
+		u32 m_misses = 0;
+	};
+
+	extern program_source_cache g_program_source_cache;
+}
@@ -19,12 +19,259 @@ namespace rsx
 {
 	namespace FIFO
 	{
+		FIFO_predecoder::FIFO_predecoder(::rsx::thread* pctrl)
+		{
+			m_ctrl = pctrl->ctrl;
+			m_iotable = &pctrl->iomap_table;
+		}
+
+		void FIFO_predecoder::restart(u32 get)
+		{
+			// Packets of older generations are dropped by the consumer
+			m_generation++;
+			m_stall_pos.release(umax);
+			m_restart_request.release((u64{m_generation} << 32) | get);
+			wake();
+		}
+
+		void FIFO_predecoder::wake()
+		{
+			m_wake++;
+			m_wake.notify_one();
+		}
+
+		bool FIFO_predecoder::pop(u32 get, decoded_packet& packet)
+		{
+			for (u32 read = m_read_pos;; read++)
+			{
+				const u32 write = m_write_pos;
+
+				if (read == write)
+				{
+					m_read_pos.release(read);
+
+					if (const u32 stall_pos = m_stall_pos; stall_pos != umax && stall_pos != get)
+					{
+						// The RSX thread went past the point where decoding stopped
+						restart(get);
+					}
+					else if (const u32 put = m_ctrl->put & ~3; put != m_notified_put)
+					{
+						// PUT is written by the guest directly, hand new values over to a sleeping producer
+						m_notified_put = put;
+						wake();
+					}
+
+					return false;
+				}
+
+				const auto& entry = m_ring[read % ring_size];
+
+				if (entry.generation != m_generation)
+				{
+					continue;
+				}
+
+				if (entry.get != get)
+				{
+					// Execution diverged from the decoded stream (e.g. GET was moved)
+					m_read_pos.release(read);
+					restart(get);
+					return false;
+				}
+
+				packet = entry;
+				m_read_pos.release(read + 1);
+
+				if (write - read >= ring_size)
+				{
+					// The producer may be waiting for space
+					wake();
+				}
+
+				return true;
+			}
+		}
+
+		void FIFO_predecoder::operator()()
+		{
+			if (g_cfg.core.thread_scheduler != thread_scheduler_mode::os)
+			{
+				thread_ctrl::set_thread_affinity_mask(thread_ctrl::get_affinity_mask(thread_class::rsx));
+			}
+
+			u32 cursor = 0;
+			u32 generation = 0;
+			u32 ret_addr = RSX_CALL_STACK_EMPTY;
+			u32 idle_spins = 0;
+			bool stalled = true;
+
+			u32 last_wake = 0;
+
+			const auto idle = [&]()
+			{
+				// Sleep until the RSX thread observes a new PUT, frees ring space or requests a restart
+				if (++idle_spins > 1000)
+				{
+					thread_ctrl::wait_on(m_wake, last_wake);
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			};
+
+			const auto stall = [&]()
+			{
+				stalled = true;
+				m_stall_pos.release(cursor);
+			};
+
+			const auto emit = [&](u32 addr, u32 cmd, u32 count, u32 nop_length)
+			{
+				idle_spins = 0;
+
+				const u32 write = m_write_pos;
+				m_ring[write % ring_size] = { cursor, addr, cmd, count, nop_length, generation };
+				m_write_pos.release(write + 1);
+			};
+
+			while (thread_ctrl::state() != thread_state::aborting)
+			{
+				// Snapshot before checking anything so that a wake-up in between is not missed
+				last_wake = m_wake;
+
+				if (const u64 request = m_restart_request.exchange(0))
+				{
+					cursor = static_cast<u32>(request);
+					generation = static_cast<u32>(request >> 32);
+					ret_addr = RSX_CALL_STACK_EMPTY;
+					stalled = false;
+				}
+
+				if (stalled)
+				{
+					thread_ctrl::wait_on(m_wake, last_wake);
+					continue;
+				}
+
+				const u32 put = m_ctrl->put & ~3;
+
+				if (cursor == put || m_write_pos - m_read_pos >= ring_size)
+				{
+					// Caught up with PUT or the RSX thread
+					idle();
+					continue;
+				}
+
+				const u32 addr = m_iotable->get_addr(cursor);
+
+				if (addr == umax)
+				{
+					stall();
+					continue;
+				}
+
+				const u32 cmd = vm::read32(addr);
+
+				if (cmd & RSX_METHOD_NON_METHOD_CMD_MASK)
+				{
+					if (const bool old_jump = (cmd & RSX_METHOD_OLD_JUMP_CMD_MASK) == RSX_METHOD_OLD_JUMP_CMD;
+						old_jump || (cmd & RSX_METHOD_NEW_JUMP_CMD_MASK) == RSX_METHOD_NEW_JUMP_CMD)
+					{
+						const u32 offs = cmd & (old_jump ? RSX_METHOD_OLD_JUMP_OFFSET_MASK : RSX_METHOD_NEW_JUMP_OFFSET_MASK);
+
+						if (offs == cursor)
+						{
+							// Jump to self is a spin loop which cell may patch at any time, leave it to the RSX thread
+							stall();
+							continue;
+						}
+
+						emit(addr, cmd, 0, 0);
+						cursor = offs;
+						continue;
+					}
+
+					if ((cmd & RSX_METHOD_CALL_CMD_MASK) == RSX_METHOD_CALL_CMD && ret_addr == RSX_CALL_STACK_EMPTY)
+					{
+						emit(addr, cmd, 0, 0);
+						ret_addr = cursor + 4;
+						cursor = cmd & RSX_METHOD_CALL_OFFSET_MASK;
+						continue;
+					}
+
+					if ((cmd & RSX_METHOD_RETURN_MASK) == RSX_METHOD_RETURN_CMD && ret_addr != RSX_CALL_STACK_EMPTY)
+					{
+						emit(addr, cmd, 0, 0);
+						cursor = std::exchange(ret_addr, RSX_CALL_STACK_EMPTY);
+						continue;
+					}
+
+					// Return without a known call site or malformed command
+					stall();
+					continue;
+				}
+
+				const u32 count = (cmd >> 18) & 0x7ff;
+
+				if (!count)
+				{
+					// Coalesce the NOP run up to PUT or the end of the 1MB page
+					u32 length = 4;
+
+					while (cursor + length != put && ((cursor + length) & 0xfffff))
+					{
+						const u32 next = vm::read32(addr + length);
+
+						if ((next & RSX_METHOD_NON_METHOD_CMD_MASK) || ((next >> 18) & 0x7ff))
+						{
+							break;
+						}
+
+						length += 4;
+					}
+
+					emit(addr, cmd, 0, length);
+					cursor += length;
+					continue;
+				}
+
+				const u32 end = cursor + 4 + count * 4;
+
+				if (put - cursor < end - cursor)
+				{
+					// Arguments have not been committed yet
+					idle();
+					continue;
+				}
+
+				if (m_iotable->get_addr(end - 4) != addr + count * 4)
+				{
+					// Arguments are not contiguous in memory
+					stall();
+					continue;
+				}
+
+				emit(addr, cmd, count, 0);
+				cursor = end;
+			}
+		}
+
 		FIFO_control::FIFO_control(::rsx::thread* pctrl)
 		{
 			m_ctrl = pctrl->ctrl;
 			m_iotable = &pctrl->iomap_table;
+
+			if (g_cfg.core.rsx_fifo_predecoding && !g_cfg.core.rsx_fifo_accuracy)
+			{
+				m_predecoder = std::make_unique<named_thread<FIFO_predecoder>>(pctrl);
+				m_predecoder->restart(m_internal_get);
+			}
 		}
 
+		FIFO_control::~FIFO_control() = default;
+
 		void FIFO_control::sync_get() const
 		{
 			m_ctrl->get.release(m_internal_get);
@@ -38,6 +285,11 @@ namespace rsx
 			m_internal_get = m_ctrl->get;
 			m_args_ptr = m_iotable->get_addr(m_internal_get);	
 			m_command_reg = (m_cmd & 0xffff) + m_command_inc * (((m_cmd >> 18) - count) & 0x7ff);
+
+			if (m_predecoder)
+			{
+				m_predecoder->restart(m_internal_get);
+			}
 		}
 
 		void FIFO_control::inc_get(bool wait)
@@ -186,6 +438,8 @@ namespace rsx
 		{
 			invalidate_cache();
 
+			const u32 predecoded_target = std::exchange(m_predecoded_target, umax);
+
 			if (spin_cmd && m_ctrl->get == get)
 			{
 				m_memwatch_addr = get;
@@ -196,6 +450,12 @@ namespace rsx
 			// Update ctrl registers
 			m_ctrl->get.release(m_internal_get = get);
 			m_remaining_commands = 0;
+
+			if (m_predecoder && predecoded_target != get)
+			{
+				// Point the decoder at the new GET before the RSX thread asks for it
+				m_predecoder->restart(get);
+			}
 		}
 
 		std::span<const u32> FIFO_control::get_current_arg_ptr() const
@@ -310,6 +570,11 @@ namespace rsx
 				m_memwatch_cmp = 0;
 			}
 
+			if (m_predecoder && read_predecoded(data))
+			{
+				return;
+			}
+
 			if (!g_cfg.core.rsx_fifo_accuracy)
 			{
 				const u32 put = read_put();
@@ -420,6 +685,66 @@ namespace rsx
 			data.set(m_cmd & 0xfffc, vm::read32(m_args_ptr));
 		}
 
+		bool FIFO_control::read_predecoded(register_pair& data)
+		{
+			decoded_packet packet;
+
+			if (!m_predecoder->pop(m_internal_get, packet))
+			{
+				return false;
+			}
+
+			// IO mappings and the command stream may have been modified by the guest since decoding
+			if (m_iotable->get_addr(packet.get) != packet.addr || vm::read32(packet.addr) != packet.cmd)
+			{
+				m_predecoder->discard(m_internal_get);
+				return false;
+			}
+
+			m_cmd = packet.cmd;
+
+			if (m_cmd & RSX_METHOD_NON_METHOD_CMD_MASK)
+			{
+				// Flow control, handled by the caller
+				if ((m_cmd & RSX_METHOD_OLD_JUMP_CMD_MASK) == RSX_METHOD_OLD_JUMP_CMD)
+				{
+					m_predecoded_target = m_cmd & RSX_METHOD_OLD_JUMP_OFFSET_MASK;
+				}
+				else if ((m_cmd & RSX_METHOD_NEW_JUMP_CMD_MASK) == RSX_METHOD_NEW_JUMP_CMD)
+				{
+					m_predecoded_target = m_cmd & RSX_METHOD_NEW_JUMP_OFFSET_MASK;
+				}
+				else if ((m_cmd & RSX_METHOD_CALL_CMD_MASK) == RSX_METHOD_CALL_CMD)
+				{
+					m_predecoded_target = m_cmd & RSX_METHOD_CALL_OFFSET_MASK;
+				}
+
+				data.reg = m_cmd;
+				return true;
+			}
+
+			if (!packet.count)
+			{
+				m_ctrl->get.release(m_internal_get += packet.nop_length);
+				data.reg = FIFO_NOP;
+				return true;
+			}
+
+			if (packet.count > 1)
+			{
+				m_command_reg = m_cmd & 0xfffc;
+				m_command_inc = ((m_cmd & RSX_METHOD_NON_INCREMENT_CMD_MASK) == RSX_METHOD_NON_INCREMENT_CMD) ? 0 : 4;
+				m_remaining_commands = packet.count - 1;
+			}
+
+			// Arguments were committed and contiguous at decode time
+			m_internal_get += 4;
+			m_args_ptr = packet.addr + 4;
+
+			data.set(m_cmd & 0xfffc, vm::read32(m_args_ptr));
+			return true;
+		}
+
 		void flattening_helper::reset(bool _enabled)
 		{
 			enabled = _enabled;
@@ -811,12 +1136,27 @@ namespace rsx
 			const u32 reg = (command.reg & 0xffff) >> 2;
 			const u32 value = command.value;
 
+			if (m_skip_redundant_writes && methods_skip_on_match[reg] && method_registers.test(reg, value))
+			{
+				// Handler would observe no change
+				m_frame_stats.redundant_writes++;
+				(*m_redundant_write_stats)[reg]++;
+				continue;
+			}
+
 			method_registers.decode(reg, value);
 
 			if (auto method = methods[reg])
 			{
+				const u64 method_start = m_profiler.enabled ? utils::get_tsc() : 0;
+
 				method(this, reg, value);
 
+				if (method_start)
+				{
+					m_method_ticks += utils::get_tsc() - method_start;
+				}
+
 				if (state & cpu_flag::again)
 				{
 					method_registers.decode(reg, method_registers.register_previous_value);
@@ -1,12 +1,16 @@
 #pragma once
 
 #include "util/types.hpp"
+#include "util/atomic.hpp"
 #include "Emu/RSX/gcm_enums.h"
 
 #include <span>
 
 struct RsxDmaControl;
 
+template <typename T>
+class named_thread;
+
 namespace rsx
 {
 	class thread;
@@ -110,11 +114,59 @@ namespace rsx
 			inline flatten_op test(register_pair& command);
 		};
 
+		struct decoded_packet
+		{
+			u32 get;        // IO offset of the command header
+			u32 addr;       // Translated address of the command header
+			u32 cmd;        // Command header
+			u32 count;      // Number of method arguments (0 for flow control and NOPs)
+			u32 nop_length; // Length in bytes of a coalesced NOP run starting at 'get'
+			u32 generation;
+		};
+
+		// Walks the command stream ahead of the RSX thread, following flow control, coalescing NOPs
+		// and translating IO addresses. Decoded packets are handed over through a single-producer ring.
+		// The consumer validates every packet against its own GET and the command in memory before use.
+		class FIFO_predecoder
+		{
+			static constexpr u32 ring_size = 1024;
+
+			RsxDmaControl* m_ctrl = nullptr;
+			const rsx::rsx_iomap_table* m_iotable;
+
+			std::array<decoded_packet, ring_size> m_ring{};
+			atomic_t<u32> m_write_pos = 0;
+			atomic_t<u32> m_read_pos = 0;
+
+			// Consumer-side restart request: generation in the high half, GET in the low half
+			atomic_t<u64> m_restart_request = 0;
+			u32 m_generation = 0;
+
+			// Position the producer stopped at, umax while running
+			atomic_t<u32> m_stall_pos = umax;
+
+			// Bumped on restart requests, new PUT values and freed ring space, the producer sleeps on it when idle
+			atomic_t<u32> m_wake = 0;
+			u32 m_notified_put = umax; // Consumer-side, last PUT handed over to the producer
+
+		public:
+			FIFO_predecoder(rsx::thread* pctrl);
+
+			void operator()();
+			void restart(u32 get);
+			void wake();
+			bool pop(u32 get, decoded_packet& packet);
+			void discard(u32 get) { restart(get); }
+
+			static constexpr auto thread_name = "RSX FIFO Pre-decoder"sv;
+		};
+
 		class FIFO_control
 		{
 		private:
 			RsxDmaControl* m_ctrl = nullptr;
 			const rsx::rsx_iomap_table* m_iotable;
+			std::unique_ptr<named_thread<FIFO_predecoder>> m_predecoder;
 			u32 m_internal_get = 0;
 
 			u32 m_memwatch_addr = 0;
@@ -125,13 +177,14 @@ namespace rsx
 			u32 m_remaining_commands = 0;
 			u32 m_args_ptr = 0;
 			u32 m_cmd = ~0u;
+			u32 m_predecoded_target = umax; // Target of the last branch the predecoder already followed
 
 			u32 m_cache_addr = 0;
 			u32 m_cache_size = 0;
 			alignas(64) std::byte m_cache[8][128];
 		public:
 			FIFO_control(rsx::thread* pctrl);
-			~FIFO_control() = default;
+			~FIFO_control();
 
 			std::pair<bool, u32> fetch_u32(u32 addr);
 			void invalidate_cache() { m_cache_size = 0; }
@@ -151,6 +204,7 @@ namespace rsx
 			u32 read_put() const;
 
 			void read(register_pair& data);
+			bool read_predecoded(register_pair& data);
 			inline bool read_unsafe(register_pair& data);
 			bool skip_methods(u32 count);
 		};
@@ -6,6 +6,8 @@
 
 #include <thread>
 #include "util/asm.hpp"
+#include "util/tsc.hpp"
+#include "util/sysinfo.hpp"
 
 namespace rsx
 {
@@ -18,6 +20,34 @@ namespace rsx
 
 		thread_base* current_thread_ = nullptr;
 
+		void wait_for_fence(const transport_packet& job)
+		{
+			auto& dma = g_fxo->get<dma_manager>();
+			const u64 start = utils::get_tsc();
+
+			for (usz i = 0; i < job.fence.size(); ++i)
+			{
+				auto& worker = *dma.m_workers[i];
+				if (&worker == this)
+				{
+					// Own queue is already ordered
+					continue;
+				}
+
+				while (worker.m_processed_count.load() < job.fence[i])
+				{
+					if (thread_ctrl::state() == thread_state::aborting)
+					{
+						return;
+					}
+
+					utils::pause();
+				}
+			}
+
+			dma.m_fence_wait_ticks += utils::get_tsc() - start;
+		}
+
 		void operator ()()
 		{
 			if (!g_cfg.video.multithreaded_rsx)
@@ -59,6 +89,8 @@ namespace rsx
 					}
 					case callback:
 					{
+						// Backend requests must observe every transfer queued before them, regardless of the worker that picked it up
+						wait_for_fence(job);
 						rsx::get_current_renderer()->renderctl(job.aux_param0, job.src);
 						break;
 					}
@@ -87,11 +119,79 @@ namespace rsx
 	// initialization
 	void dma_manager::init()
 	{
-		m_thread = std::make_shared<named_thread<offload_thread>>();
+		// Only the first worker is spawned when offloading is disabled, it exits immediately
+		const u32 worker_count = g_cfg.video.multithreaded_rsx ? static_cast<u32>(g_cfg.video.offload_worker_count) : 1;
+
+		m_worker_count = std::min<u32>(worker_count, ::size32(m_workers));
+		m_next_worker = 0;
+
+		for (u32 i = 0; i < m_worker_count; ++i)
+		{
+			m_workers[i] = std::make_shared<named_thread<offload_thread>>(fmt::format("RSX Offloader %u", i));
+		}
+
+		rsx_log.notice("RSX offloader started with %u worker(s)", m_worker_count);
+	}
+
+	dma_manager::offload_thread& dma_manager::get_transfer_worker()
+	{
+		// Pick the least loaded worker, starting from a rotating index so ties are spread evenly
+		const u32 count = m_worker_count;
+		const u32 first = m_next_worker;
+		m_next_worker = (first + 1) % count;
+
+		offload_thread* best = nullptr;
+		u64 best_depth = umax;
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			auto& worker = *m_workers[(first + i) % count];
+			const u64 depth = worker.m_enqueued_count.load() - worker.m_processed_count.load();
+
+			if (depth < best_depth)
+			{
+				best = &worker;
+				best_depth = depth;
+
+				if (!depth)
+				{
+					break;
+				}
+			}
+		}
+
+		return *best;
+	}
+
+	dma_manager::offload_thread* dma_manager::get_current_worker() const
+	{
+		if (auto cpu = thread_ctrl::get_current())
+		{
+			for (u32 i = 0; i < m_worker_count; ++i)
+			{
+				if (m_workers[i]->current_thread_ == cpu)
+				{
+					return m_workers[i].get();
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	void dma_manager::enqueue(offload_thread& worker)
+	{
+		// Must be called after the packet is pushed; the producer is always the RSX thread
+		const u64 depth = ++worker.m_enqueued_count - worker.m_processed_count.load();
+
+		if (depth > m_max_queue_depth.load())
+		{
+			m_max_queue_depth.release(depth);
+		}
 	}
 
 	// General transport
-	void dma_manager::copy(void *dst, std::vector<u8>& src, u32 length) const
+	void dma_manager::copy(void *dst, std::vector<u8>& src, u32 length)
 	{
 		if (length <= max_immediate_transfer_size || !g_cfg.video.multithreaded_rsx)
 		{
@@ -99,12 +199,13 @@ namespace rsx
 		}
 		else
 		{
-			m_thread->m_enqueued_count++;
-			m_thread->m_work_queue.push(dst, src, length);
+			auto& worker = get_transfer_worker();
+			worker.m_work_queue.push(dst, src, length);
+			enqueue(worker);
 		}
 	}
 
-	void dma_manager::copy(void *dst, void *src, u32 length) const
+	void dma_manager::copy(void *dst, void *src, u32 length)
 	{
 		if (length <= max_immediate_transfer_size || !g_cfg.video.multithreaded_rsx)
 		{
@@ -112,8 +213,9 @@ namespace rsx
 		}
 		else
 		{
-			m_thread->m_enqueued_count++;
-			m_thread->m_work_queue.push(dst, src, length);
+			auto& worker = get_transfer_worker();
+			worker.m_work_queue.push(dst, src, length);
+			enqueue(worker);
 		}
 	}
 
@@ -127,8 +229,9 @@ namespace rsx
 		}
 		else
 		{
-			m_thread->m_enqueued_count++;
-			m_thread->m_work_queue.push(dst, primitive, count);
+			auto& worker = get_transfer_worker();
+			worker.m_work_queue.push(dst, primitive, count);
+			enqueue(worker);
 		}
 	}
 
@@ -137,31 +240,55 @@ namespace rsx
 	{
 		ensure(g_cfg.video.multithreaded_rsx);
 
-		m_thread->m_enqueued_count++;
-		m_thread->m_work_queue.push(request_code, args);
+		// Callbacks are serialized on the first worker and fenced against everything queued on the others before them
+		std::vector<u64> fence;
+
+		if (m_worker_count > 1)
+		{
+			fence.reserve(m_worker_count);
+
+			for (u32 i = 0; i < m_worker_count; ++i)
+			{
+				fence.push_back(m_workers[i]->m_enqueued_count.load());
+			}
+
+			m_fence_count++;
+		}
+
+		auto& worker = *m_workers[0];
+		worker.m_work_queue.push(request_code, args, std::move(fence));
+		enqueue(worker);
 	}
 
 	// Synchronization
 	bool dma_manager::is_current_thread() const
 	{
-		if (auto cpu = thread_ctrl::get_current())
-		{
-			return m_thread->current_thread_ == cpu;
-		}
-
-		return false;
+		return get_current_worker() != nullptr;
 	}
 
 	bool dma_manager::sync() const
 	{
-		auto& _thr = *m_thread;
+		const auto is_idle = [this]()
+		{
+			for (u32 i = 0; i < m_worker_count; ++i)
+			{
+				if (m_workers[i]->m_enqueued_count.load() > m_workers[i]->m_processed_count.load())
+				{
+					return false;
+				}
+			}
+
+			return true;
+		};
 
-		if (_thr.m_enqueued_count.load() <= _thr.m_processed_count.load()) [[likely]]
+		if (is_idle()) [[likely]]
 		{
 			// Nothing to do
 			return true;
 		}
 
+		const u64 start = utils::get_tsc();
+
 		if (auto rsxthr = get_current_renderer(); rsxthr->is_current_thread())
 		{
 			if (m_mem_fault_flag)
@@ -170,7 +297,7 @@ namespace rsx
 				return false;
 			}
 
-			while (_thr.m_enqueued_count.load() > _thr.m_processed_count.load())
+			while (!is_idle())
 			{
 				rsxthr->on_semaphore_acquire_wait();
 				utils::pause();
@@ -178,23 +305,40 @@ namespace rsx
 		}
 		else
 		{
-			while (_thr.m_enqueued_count.load() > _thr.m_processed_count.load())
+			while (!is_idle())
 				utils::pause();
 		}
 
+		m_sync_wait_ticks += utils::get_tsc() - start;
 		return true;
 	}
 
 	void dma_manager::join()
 	{
 		sync();
-		*m_thread = thread_state::aborting;
+
+		for (u32 i = 0; i < m_worker_count; ++i)
+		{
+			*m_workers[i] = thread_state::aborting;
+		}
+
+		if (g_cfg.video.multithreaded_rsx)
+		{
+			const auto stats = get_statistics();
+			rsx_log.notice("RSX offloader: %llu packets, %llu fences, max queue depth %llu, sync wait %llu us, fence wait %llu us",
+				stats.enqueued, stats.fences, stats.max_queue_depth, stats.sync_wait_us, stats.fence_wait_us);
+		}
 	}
 
 	void dma_manager::set_mem_fault_flag()
 	{
 		ensure(is_current_thread()); // "Access denied"
-		m_mem_fault_flag.release(true);
+
+		// Only one worker can be in recovery at a time, the backend tracks a single fault range
+		while (m_mem_fault_flag.test_and_set())
+		{
+			utils::pause();
+		}
 	}
 
 	void dma_manager::clear_mem_fault_flag()
@@ -206,7 +350,7 @@ namespace rsx
 	// Fault recovery
 	utils::address_range dma_manager::get_fault_range(bool writing) const
 	{
-		const auto m_current_job = ensure(m_thread->m_current_job);
+		const auto m_current_job = ensure(ensure(get_current_worker())->m_current_job);
 
 		void *address = nullptr;
 		u32 range = m_current_job->length;
@@ -231,4 +375,39 @@ namespace rsx
 
 		return utils::address_range::start_length(vm::get_addr(address), range);
 	}
+
+	// Telemetry
+	dma_manager::statistics_t dma_manager::get_statistics(bool reset)
+	{
+		statistics_t result{};
+		u64 total_enqueued = 0;
+
+		for (u32 i = 0; i < m_worker_count; ++i)
+		{
+			const u64 enqueued = m_workers[i]->m_enqueued_count.load();
+			const u64 processed = m_workers[i]->m_processed_count.load();
+
+			total_enqueued += enqueued;
+			result.queue_depth += (enqueued > processed) ? (enqueued - processed) : 0;
+		}
+
+		const u64 freq = std::max<u64>(utils::get_tsc_freq(), 1);
+
+		result.enqueued = total_enqueued - m_enqueued_baseline;
+		result.fences = m_fence_count.load();
+		result.max_queue_depth = m_max_queue_depth.load();
+		result.sync_wait_us = m_sync_wait_ticks.load() * 1'000'000 / freq;
+		result.fence_wait_us = m_fence_wait_ticks.load() * 1'000'000 / freq;
+
+		if (reset)
+		{
+			m_enqueued_baseline = total_enqueued;
+			m_fence_count.release(0);
+			m_max_queue_depth.release(0);
+			m_sync_wait_ticks.release(0);
+			m_fence_wait_ticks.release(0);
+		}
+
+		return result;
+	}
 }
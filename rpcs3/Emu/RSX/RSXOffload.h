@@ -4,6 +4,7 @@
 #include "Utilities/address_range.h"
 #include "gcm_enums.h"
 
+#include <array>
 #include <vector>
 
 template <typename T>
@@ -30,6 +31,7 @@ namespace rsx
 			u32 length{};
 			u32 aux_param0{};
 			u32 aux_param1{};
+			std::vector<u64> fence{};
 
 			transport_packet(void *_dst, void *_src, u32 len)
 				: type(op::raw_copy), src(_src), dst(_dst), length(len)
@@ -43,8 +45,8 @@ namespace rsx
 				: type(op::index_emulate), dst(_dst), length(len), aux_param0(static_cast<u8>(prim))
 			{}
 
-			transport_packet(u32 command, void* args)
-				: type(op::callback), src(args), aux_param0(command)
+			transport_packet(u32 command, void* args, std::vector<u64>&& _fence)
+				: type(op::callback), src(args), aux_param0(command), fence(std::move(_fence))
 			{}
 
 			transport_packet(const transport_packet&) = delete;
@@ -54,20 +56,43 @@ namespace rsx
 		atomic_t<bool> m_mem_fault_flag = false;
 
 		struct offload_thread;
-		std::shared_ptr<named_thread<offload_thread>> m_thread;
+		std::array<std::shared_ptr<named_thread<offload_thread>>, 8> m_workers{};
+		u32 m_worker_count = 0;
+		u32 m_next_worker = 0;
+
+		// Telemetry
+		atomic_t<u64> m_max_queue_depth = 0;
+		mutable atomic_t<u64> m_sync_wait_ticks = 0;
+		atomic_t<u64> m_fence_wait_ticks = 0;
+		atomic_t<u64> m_fence_count = 0;
+		u64 m_enqueued_baseline = 0;
+
+		offload_thread& get_transfer_worker();
+		offload_thread* get_current_worker() const;
+		void enqueue(offload_thread& worker);
 
 		// TODO: Improved benchmarks here; value determined by profiling on a Ryzen CPU, rounded to the nearest 512 bytes
 		const u32 max_immediate_transfer_size = 3584;
 
 	public:
+		struct statistics_t
+		{
+			u64 enqueued = 0;          // Packets submitted since the last reset
+			u64 fences = 0;            // Backend callbacks fenced against other workers
+			u64 queue_depth = 0;       // Packets currently in flight across all workers
+			u64 max_queue_depth = 0;   // Deepest single worker queue observed
+			u64 sync_wait_us = 0;      // Time spent by callers blocked in sync()
+			u64 fence_wait_us = 0;     // Time spent by fences waiting for other workers
+		};
+
 		dma_manager() = default;
 
 		// initialization
 		void init();
 
 		// General tranport
-		void copy(void *dst, std::vector<u8>& src, u32 length) const;
-		void copy(void *dst, void *src, u32 length) const;
+		void copy(void *dst, std::vector<u8>& src, u32 length);
+		void copy(void *dst, void *src, u32 length);
 
 		// Vertex utilities
 		void emulate_as_indexed(void *dst, rsx::primitive_type primitive, u32 count);
@@ -84,5 +109,8 @@ namespace rsx
 
 		// Fault recovery
 		utils::address_range get_fault_range(bool writing) const;
+
+		// Telemetry
+		statistics_t get_statistics(bool reset = false);
 	};
 }
@@ -69,12 +69,6 @@ bool serialize<rsx::frame_capture_data>(utils::serial& ar, rsx::frame_capture_da
 	return ar(o.tile_map, o.memory_map, o.memory_data_map, o.display_buffers_map, o.replay_commands, o.reg_state);
 }
 
-template <>
-bool serialize<rsx::frame_capture_data::memory_block_data>(utils::serial& ar, rsx::frame_capture_data::memory_block_data& o)
-{
-	return ar(o.data);
-}
-
 template <>
 bool serialize<rsx::frame_capture_data::replay_command>(utils::serial& ar, rsx::frame_capture_data::replay_command& o)
 {
@@ -498,6 +492,13 @@ namespace rsx
 		m_vertex_textures_dirty.fill(true);
 
 		m_graphics_state = pipeline_state::all_dirty;
+		m_profiler.enabled = g_cfg.video.overlay || g_cfg.video.frontend_profiling || g_cfg.video.cache_telemetry != cache_telemetry_format::disabled || g_cfg.video.frame_time_recording;
+
+		if (g_cfg.video.skip_redundant_register_writes && !g_cfg.video.strict_rendering_mode)
+		{
+			m_skip_redundant_writes = true;
+			m_redundant_write_stats = std::make_unique<std::array<u64, 0x10000 / 4>>();
+		}
 
 		g_user_asked_for_frame_capture = false;
 
@@ -908,7 +909,14 @@ namespace rsx
 			}
 
 			// Execute FIFO queue
+			const u64 fifo_start = m_profiler.enabled ? utils::get_tsc() : 0;
+
 			run_FIFO();
+
+			if (fifo_start)
+			{
+				m_fifo_ticks += utils::get_tsc() - fifo_start;
+			}
 		}
 	}
 
@@ -922,12 +930,45 @@ namespace rsx
 		// Deregister violation handler
 		g_access_violation_handler = nullptr;
 
+		if (capture_current_frame)
+		{
+			// Unfinished capture, the pending file is discarded
+			capture_current_frame = false;
+			capture::abort_capture_file();
+			frame_capture.reset();
+		}
+
 		// Clear any pending flush requests to release threads
 		std::this_thread::sleep_for(10ms);
 		do_local_task(rsx::FIFO_state::lock_wait);
 
 		g_fxo->get<rsx::dma_manager>().join();
 		state += cpu_flag::exit;
+
+		m_frame_time_recorder.finish();
+		flush_cache_telemetry();
+
+		if (m_redundant_write_stats)
+		{
+			// Report the methods most frequently rewritten with their current value
+			std::vector<std::pair<u64, u32>> top_methods;
+
+			for (u32 reg = 0; reg < m_redundant_write_stats->size(); ++reg)
+			{
+				if (const u64 count = (*m_redundant_write_stats)[reg])
+				{
+					top_methods.emplace_back(count, reg);
+				}
+			}
+
+			const usz num_reported = std::min<usz>(top_methods.size(), 10);
+			std::partial_sort(top_methods.begin(), top_methods.begin() + num_reported, top_methods.end(), std::greater<>());
+
+			for (usz i = 0; i < num_reported; ++i)
+			{
+				rsx_log.notice("Redundant register writes skipped: %s x%u", rsx::get_method_name(top_methods[i].second), top_methods[i].first);
+			}
+		}
 	}
 
 	void thread::fill_scale_offset_data(void *buffer, bool flip_y) const
@@ -3228,40 +3269,49 @@ namespace rsx
 		// Marks the end of a frame scope GPU-side
 		if (g_user_asked_for_frame_capture.exchange(false) && !capture_current_frame)
 		{
-			capture_current_frame = true;
 			frame_debug.reset();
 			frame_capture.reset();
 
-			// random number just to jumpstart the size
-			frame_capture.replay_commands.reserve(8000);
+			capture_file_path = fs::get_config_dir() + "captures/" + Emu.GetTitleID() + "_" + date_time::current_time_narrow() + "_capture.rrc";
+
+			if (capture::begin_capture_file(capture_file_path))
+			{
+				capture_current_frame = true;
+				capture_frames_remaining = g_cfg.video.frame_capture_count;
 
-			// capture first tile state with nop cmd
-			rsx::frame_capture_data::replay_command replay_cmd;
-			replay_cmd.rsx_command = std::make_pair(NV4097_NO_OPERATION, 0);
-			frame_capture.replay_commands.push_back(replay_cmd);
-			capture::capture_display_tile_state(this, frame_capture.replay_commands.back());
+				// random number just to jumpstart the size
+				frame_capture.replay_commands.reserve(8000);
+
+				// capture first tile state with nop cmd
+				rsx::frame_capture_data::replay_command replay_cmd;
+				replay_cmd.rsx_command = std::make_pair(NV4097_NO_OPERATION, 0);
+				frame_capture.replay_commands.push_back(replay_cmd);
+				capture::capture_display_tile_state(this, frame_capture.replay_commands.back());
+			}
+			else
+			{
+				rsx_log.fatal("Capture failed: %s (%s)", capture_file_path, fs::g_tls_error);
+			}
 		}
-		else if (capture_current_frame)
+		else if (capture_current_frame && --capture_frames_remaining == 0)
 		{
 			capture_current_frame = false;
 
-			const std::string file_path = fs::get_config_dir() + "captures/" + Emu.GetTitleID() + "_" + date_time::current_time_narrow() + "_capture.rrc";
+			// Memory blocks are already on disk, only the command stream and block index remain
+			capture::flush_capture_file();
 
-			// todo: may want to compress this data?
 			utils::serial save_manager;
-			save_manager.reserve(0x800'0000); // 128MB
+			save_manager.reserve(0x100'0000); // 16MB
 
 			save_manager(frame_capture);
 
-			fs::pending_file temp(file_path);
-
-			if (temp.file && (temp.file.write(save_manager.data), temp.commit(false)))
+			if (capture::commit_capture_file(save_manager.data))
 			{
-				rsx_log.success("Capture successful: %s", file_path);
+				rsx_log.success("Capture successful: %s", capture_file_path);
 			}
 			else
 			{
-				rsx_log.fatal("Capture failed: %s (%s)", file_path, fs::g_tls_error);
+				rsx_log.fatal("Capture failed: %s (%s)", capture_file_path, fs::g_tls_error);
 			}
 
 			frame_capture.reset();
@@ -3277,6 +3327,26 @@ namespace rsx
 			zcull_ctrl->clear(this, CELL_GCM_ZPASS_PIXEL_CNT | CELL_GCM_ZCULL_STATS);
 		}
 
+		if (m_profiler.enabled)
+		{
+			if (const u64 tsc_freq = utils::get_tsc_freq())
+			{
+				m_frame_stats.fifo_time = static_cast<s64>(std::exchange(m_fifo_ticks, 0) * 1'000'000 / tsc_freq);
+				m_frame_stats.method_time = static_cast<s64>(std::exchange(m_method_ticks, 0) * 1'000'000 / tsc_freq);
+			}
+
+			if (record_frame_stats)
+			{
+				frame_stats_log.push(m_frame_stats);
+			}
+		}
+
+		if (g_cfg.video.cache_telemetry != cache_telemetry_format::disabled)
+		{
+			m_frame_stats.texture_cache = get_texture_cache_statistics();
+			write_cache_telemetry();
+		}
+
 		// Save current state
 		m_queued_flip.stats = m_frame_stats;
 		m_queued_flip.push(buffer);
@@ -3317,7 +3387,77 @@ namespace rsx
 
 		// Reset current stats
 		m_frame_stats = {};
-		m_profiler.enabled = !!g_cfg.video.overlay;
+		m_profiler.enabled = g_cfg.video.overlay || g_cfg.video.frontend_profiling || g_cfg.video.cache_telemetry != cache_telemetry_format::disabled || g_cfg.video.frame_time_recording;
+	}
+
+	void thread::write_cache_telemetry()
+	{
+		const bool json = g_cfg.video.cache_telemetry == cache_telemetry_format::json;
+
+		if (!m_cache_telemetry_file)
+		{
+			if (m_cache_telemetry_frame)
+			{
+				// Opening the file failed
+				return;
+			}
+
+			m_cache_telemetry_frame = 1;
+
+			const std::string dir_path = fs::get_cache_dir() + "telemetry/";
+			const std::string file_path = dir_path + Emu.GetTitleID() + "_" + date_time::current_time_narrow() + (json ? ".jsonl" : ".csv");
+
+			if (!fs::create_path(dir_path) || !m_cache_telemetry_file.open(file_path, fs::rewrite))
+			{
+				rsx_log.error("Failed to create cache telemetry file %s (%s)", file_path, fs::g_tls_error);
+				return;
+			}
+
+			rsx_log.notice("Writing cache telemetry to %s", file_path);
+
+			if (!json)
+			{
+				m_cache_telemetry_pending = "frame,draw_calls,fifo_us,setup_us,textures_upload_us,draw_exec_us,"
+					"sections_created,sections_destroyed,flushes,cache_misses,predictor_hits,predictor_misses,invalidations,surface_lookups,"
+					"bytes_uploaded,bytes_flushed,upload_us,flush_us,invalidate_us\n";
+			}
+		}
+
+		const auto& stats = m_frame_stats;
+		const auto& tc = stats.texture_cache;
+		const u32 frame = m_cache_telemetry_frame++;
+
+		if (json)
+		{
+			fmt::append(m_cache_telemetry_pending, "{\"frame\":%u,\"draw_calls\":%u,\"fifo_us\":%d,\"setup_us\":%d,\"textures_upload_us\":%d,\"draw_exec_us\":%d,"
+				"\"sections_created\":%u,\"sections_destroyed\":%u,\"flushes\":%u,\"cache_misses\":%u,\"predictor_hits\":%u,\"predictor_misses\":%u,"
+				"\"invalidations\":%u,\"surface_lookups\":%u,\"bytes_uploaded\":%u,\"bytes_flushed\":%u,\"upload_us\":%d,\"flush_us\":%d,\"invalidate_us\":%d}\n",
+				frame, stats.draw_calls, stats.fifo_time, stats.setup_time, stats.textures_upload_time, stats.draw_exec_time,
+				tc.sections_created, tc.sections_destroyed, tc.flushes, tc.cache_misses, tc.predictor_hits, tc.predictor_misses,
+				tc.invalidations, tc.surface_lookups, tc.bytes_uploaded, tc.bytes_flushed, tc.upload_time, tc.flush_time, tc.invalidate_time);
+		}
+		else
+		{
+			fmt::append(m_cache_telemetry_pending, "%u,%u,%d,%d,%d,%d,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%d,%d,%d\n",
+				frame, stats.draw_calls, stats.fifo_time, stats.setup_time, stats.textures_upload_time, stats.draw_exec_time,
+				tc.sections_created, tc.sections_destroyed, tc.flushes, tc.cache_misses, tc.predictor_hits, tc.predictor_misses,
+				tc.invalidations, tc.surface_lookups, tc.bytes_uploaded, tc.bytes_flushed, tc.upload_time, tc.flush_time, tc.invalidate_time);
+		}
+
+		if (m_cache_telemetry_pending.size() >= 64 * 1024)
+		{
+			flush_cache_telemetry();
+		}
+	}
+
+	void thread::flush_cache_telemetry()
+	{
+		if (m_cache_telemetry_file && !m_cache_telemetry_pending.empty())
+		{
+			m_cache_telemetry_file.write(m_cache_telemetry_pending);
+		}
+
+		m_cache_telemetry_pending.clear();
 	}
 
 	bool thread::request_emu_flip(u32 buffer)
@@ -3403,6 +3543,7 @@ namespace rsx
 					const auto delay_us = target_rsx_flip_time - time;
 					lv2_obj::wait_timeout<false, false>(delay_us);
 					performance_counters.idle_time += delay_us;
+					m_flip_wait_us += delay_us;
 				}
 			}
 
@@ -3441,8 +3582,24 @@ namespace rsx
 		m_queued_flip.in_progress = true;
 		m_queued_flip.skip_frame |= g_cfg.video.disable_video_output && !g_cfg.video.perf_overlay.perf_overlay_enabled;
 
+		const bool record_frame_time = frame_time_recorder::enabled();
+		const u64 present_start = record_frame_time ? rsx::uclock() : 0;
+
 		flip(m_queued_flip);
 
+		if (record_frame_time)
+		{
+			const auto& stats = m_queued_flip.stats;
+
+			frame_time_sample sample{};
+			sample.fifo_us = std::max<s64>(stats.fifo_time, 0);
+			sample.draw_us = std::max<s64>(stats.setup_time + stats.vertex_upload_time + stats.textures_upload_time + stats.draw_exec_time, 0);
+			sample.flip_wait_us = std::exchange(m_flip_wait_us, 0);
+			sample.present_us = rsx::uclock() - present_start;
+
+			m_frame_time_recorder.record(sample);
+		}
+
 		last_guest_flip_timestamp = rsx::uclock() - 1000000;
 		flip_status = CELL_GCM_DISPLAY_FLIP_STATUS_DONE;
 		m_queued_flip.in_progress = false;
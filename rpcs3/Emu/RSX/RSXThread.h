@@ -14,12 +14,14 @@
 #include "RSXZCULL.h"
 #include "rsx_utils.h"
 #include "Common/bitfield.hpp"
+#include "Common/frame_time_recorder.h"
 #include "Common/profiling_timer.hpp"
 #include "Common/texture_cache_types.h"
 #include "Program/RSXVertexProgram.h"
 #include "Program/RSXFragmentProgram.h"
 
 #include "Utilities/Thread.h"
+#include "Utilities/lockless.h"
 #include "Utilities/geometry.h"
 #include "Capture/rsx_trace.h"
 #include "Capture/rsx_replay.h"
@@ -386,12 +388,19 @@ namespace rsx
 	{
 		u32 draw_calls;
 		u32 submit_count;
+		u32 redundant_writes;
 
+		s64 fifo_time;
+		s64 method_time;
 		s64 setup_time;
 		s64 vertex_upload_time;
 		s64 textures_upload_time;
 		s64 draw_exec_time;
 		s64 flip_time;
+
+		u64 upload_bytes;
+
+		texture_cache_statistics texture_cache;
 	};
 
 	struct display_flip_info_t
@@ -476,6 +485,8 @@ namespace rsx
 
 	protected:
 		FIFO::flattening_helper m_flattener;
+		bool m_skip_redundant_writes = false;
+		std::unique_ptr<std::array<u64, 0x10000 / 4>> m_redundant_write_stats;
 		u32 fifo_ret_addr = RSX_CALL_STACK_EMPTY;
 		u32 saved_fifo_ret = RSX_CALL_STACK_EMPTY;
 		u32 restore_fifo_cmd = 0;
@@ -500,6 +511,19 @@ namespace rsx
 		// Profiler
 		rsx::profiling_timer m_profiler;
 		frame_statistics_t m_frame_stats;
+		u64 m_fifo_ticks = 0;
+		u64 m_method_ticks = 0;
+
+		// Per-frame cache telemetry export, rows are batched and written in chunks
+		fs::file m_cache_telemetry_file;
+		std::string m_cache_telemetry_pending;
+		u32 m_cache_telemetry_frame = 0;
+		void write_cache_telemetry();
+		void flush_cache_telemetry();
+
+		// Per-frame timing recorder, reports percentiles on exit
+		frame_time_recorder m_frame_time_recorder;
+		u64 m_flip_wait_us = 0;
 
 		// Savestates vrelated
 		bool m_pause_on_first_flip = false;
@@ -654,6 +678,8 @@ namespace rsx
 		vm::ptr<void(u32)> queue_handler = vm::null;
 		atomic_t<u64> vblank_count{0};
 		bool capture_current_frame = false;
+		u32 capture_frames_remaining = 0;
+		std::string capture_file_path;
 
 		u64 vblank_at_flip = umax;
 		u64 flip_notification_count = 0;
@@ -822,6 +848,9 @@ namespace rsx
 
 		virtual std::pair<std::string, std::string> get_programs() const { return std::make_pair("", ""); }
 
+		// Backends without a texture cache report nothing
+		virtual texture_cache_statistics get_texture_cache_statistics() const { return {}; }
+
 		virtual bool scaled_image_from_memory(blit_src_info& /*src_info*/, blit_dst_info& /*dst_info*/, bool /*interpolate*/) { return false; }
 
 	public:
@@ -841,6 +870,10 @@ namespace rsx
 		// Get stats object
 		frame_statistics_t& get_stats() { return m_frame_stats; }
 
+		// Completed frame statistics, only recorded while a benchmark replay drains them
+		lf_queue<frame_statistics_t> frame_stats_log;
+		atomic_t<bool> record_frame_stats = false;
+
 		// Returns true if the current thread is the active RSX thread
 		inline bool is_current_thread() const
 		{
@@ -797,12 +797,13 @@ bool VKGSRender::on_access_violation(u32 address, bool is_writing)
 		if (g_fxo->get<rsx::dma_manager>().is_current_thread())
 		{
 			// The offloader thread cannot handle flush requests
+			// Acquire the fault flag first; with several offload workers it also serializes recovery
+			g_fxo->get<rsx::dma_manager>().set_mem_fault_flag();
 			ensure(!(m_queue_status & flush_queue_state::deadlock));
 
 			m_offloader_fault_range = g_fxo->get<rsx::dma_manager>().get_fault_range(is_writing);
 			m_offloader_fault_cause = (is_writing) ? rsx::invalidation_cause::write : rsx::invalidation_cause::read;
 
-			g_fxo->get<rsx::dma_manager>().set_mem_fault_flag();
 			m_queue_status |= flush_queue_state::deadlock;
 			m_eng_interrupt_mask |= rsx::backend_interrupt;
 
@@ -889,6 +890,11 @@ void VKGSRender::on_semaphore_acquire_wait()
 	}
 }
 
+rsx::texture_cache_statistics VKGSRender::get_texture_cache_statistics() const
+{
+	return m_texture_cache.get_frame_statistics();
+}
+
 bool VKGSRender::on_vram_exhausted(rsx::problem_severity severity)
 {
 	ensure(!vk::is_uninterruptible() && rsx::get_current_renderer()->is_current_thread());
@@ -288,4 +288,6 @@ protected:
 	bool on_access_violation(u32 address, bool is_writing) override;
 	void on_invalidate_memory_range(const utils::address_range &range, rsx::invalidation_cause cause) override;
 	void on_semaphore_acquire_wait() override;
+
+	rsx::texture_cache_statistics get_texture_cache_statistics() const override;
 };
@@ -1,6 +1,7 @@
 #pragma once
 #include "Utilities/File.h"
 #include "Utilities/lockless.h"
+#include "Utilities/mutex.h"
 #include "Utilities/Thread.h"
 #include "Common/bitfield.hpp"
 #include "Emu/System.h"
@@ -10,11 +11,15 @@
 #include "Overlays/Shaders/shader_loading_dialog.h"
 
 #include <chrono>
+#include <span>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "util/sysinfo.hpp"
 #include "util/fnv_hash.hpp"
 
+#include "xxhash.h"
+
 namespace rsx
 {
 	template <typename pipeline_storage_type, typename backend_storage>
@@ -54,6 +59,42 @@ namespace rsx
 			pipeline_storage_type pipeline_properties;
 		};
 
+		// Pipelines are stored as fixed size records appended to a single archive per pipeline class
+		struct archive_header
+		{
+			u32 magic;
+			u32 record_size;
+		};
+
+		struct pipeline_record
+		{
+			u64 key;
+			u64 last_use; // Session the pipeline was last used in, recently used pipelines are loaded first
+			pipeline_data data;
+		};
+
+		struct archived_pipeline
+		{
+			u64 offset;
+			u64 last_use;
+		};
+
+		// Raw programs are appended to a shared archive, each header is followed by the program ucode
+		struct program_record
+		{
+			u64 hash;
+			u32 type;
+			u32 size;
+		};
+
+		enum program_type : u32
+		{
+			vertex_program = 0,
+			fragment_program = 1,
+		};
+
+		static constexpr u32 archive_magic = "RPSC"_u32;
+
 		std::string version_prefix;
 		std::string root_path;
 		std::string pipeline_class_name;
@@ -61,44 +102,241 @@ namespace rsx
 
 		backend_storage& m_storage;
 
+		shared_mutex m_archive_mutex;
+		bool m_archive_open = false;
+		fs::file m_pipeline_archive;
+		fs::file m_program_archive;
+		std::unordered_map<u64, archived_pipeline> m_pipeline_keys;
+		u64 m_session = 1;
+		std::unordered_set<u64> m_program_keys[2];
+
+		// Contents of the program archive, only held while loading
+		std::vector<u8> m_program_blob;
+		std::unordered_map<u64, std::span<const u8>> m_program_blob_index[2];
+
 		static std::string get_message(u32 index, u32 processed, u32 entry_count)
 		{
 			return fmt::format("%s pipeline object %u of %u", index == 0 ? "Loading" : "Compiling", processed, entry_count);
 		}
 
-		void load_shaders(uint nb_workers, unpacked_type& unpacked, std::string& directory_path, std::vector<fs::dir_entry>& entries, u32 entry_count,
-		    shader_loading_dialog* dlg)
+		std::string get_pipeline_directory() const
 		{
-			atomic_t<u32> processed(0);
+			return root_path + "/pipelines/" + pipeline_class_name + "/" + version_prefix;
+		}
 
-			std::function<void(u32)> shader_load_worker = [&](u32 stop_at)
+		static u64 get_pipeline_key(const pipeline_data& data)
+		{
+			u64 state_hash = 0;
+			state_hash ^= rpcs3::hash_base<u32>(data.vp_ctrl);
+			state_hash ^= rpcs3::hash_base<u32>(data.fp_ctrl);
+			state_hash ^= rpcs3::hash_base<u32>(data.vp_texture_dimensions);
+			state_hash ^= rpcs3::hash_base<u32>(data.fp_texture_dimensions);
+			state_hash ^= rpcs3::hash_base<u32>(data.fp_texcoord_control);
+			state_hash ^= rpcs3::hash_base<u16>(data.fp_height);
+			state_hash ^= rpcs3::hash_base<u16>(data.fp_pixel_layout);
+			state_hash ^= rpcs3::hash_base<u16>(data.fp_lighting_flags);
+			state_hash ^= rpcs3::hash_base<u16>(data.fp_shadow_textures);
+			state_hash ^= rpcs3::hash_base<u16>(data.fp_redirected_textures);
+			state_hash ^= rpcs3::hash_base<u16>(data.vp_multisampled_textures);
+			state_hash ^= rpcs3::hash_base<u16>(data.fp_multisampled_textures);
+
+			const u64 key_data[4] = { data.vertex_program_hash, data.fragment_program_hash, data.pipeline_storage_hash, state_hash };
+			return XXH64(key_data, sizeof(key_data), 0);
+		}
+
+		// Validate an archive header, incompatible or empty archives are reset
+		static bool open_archive(fs::file& archive, const std::string& path, u32 record_size)
+		{
+			if (!archive.open(path, fs::read + fs::write + fs::create))
 			{
-				u32 pos;
-				// Processed is incremented before work starts in order to avoid two workers working on the same shader
-				while (((pos = processed++) < stop_at) && !Emu.IsStopped())
+				rsx_log.error("shaders_cache: Failed to open %s (%s)", path, fs::g_tls_error);
+				return false;
+			}
+
+			archive_header header{};
+			if (archive.size() >= sizeof(header) && archive.read(header) && header.magic == archive_magic && header.record_size == record_size)
+			{
+				return true;
+			}
+
+			if (archive.size())
+			{
+				rsx_log.error("shaders_cache: Discarding %s since it's not binary compatible with the current shader cache", path);
+			}
+
+			header = { archive_magic, record_size };
+			archive.trunc(0);
+			archive.seek(0);
+			archive.write(header);
+			return true;
+		}
+
+		// Must be called with m_archive_mutex held. Returns the archived pipelines, newest first, if requested
+		std::vector<pipeline_record> open_archives(bool read_contents)
+		{
+			std::vector<pipeline_record> records;
+
+			if (m_archive_open)
+			{
+				return records;
+			}
+
+			m_archive_open = true;
+
+			const std::string directory_path = get_pipeline_directory();
+			fs::create_path(directory_path);
+			fs::create_path(root_path + "/raw");
+
+			if (open_archive(m_pipeline_archive, directory_path + "/pipelines.bin", sizeof(pipeline_record)))
+			{
+				// Drop any partially written trailing record
+				const u64 record_count = (m_pipeline_archive.size() - sizeof(archive_header)) / sizeof(pipeline_record);
+				m_pipeline_archive.trunc(sizeof(archive_header) + record_count * sizeof(pipeline_record));
+
+				std::vector<pipeline_record> archived(record_count);
+				m_pipeline_archive.seek(sizeof(archive_header));
+				m_pipeline_archive.read(archived.data(), record_count * sizeof(pipeline_record));
+
+				for (u64 i = 0; i < record_count; i++)
+				{
+					const u64 offset = sizeof(archive_header) + i * sizeof(pipeline_record);
+
+					if (m_pipeline_keys.emplace(archived[i].key, archived_pipeline{ offset, archived[i].last_use }).second && read_contents)
+					{
+						records.push_back(archived[i]);
+					}
+
+					m_session = std::max(m_session, archived[i].last_use + 1);
+				}
+
+				// Most recently used first, ties keep the most recently recorded first
+				std::reverse(records.begin(), records.end());
+				std::stable_sort(records.begin(), records.end(), [](const pipeline_record& a, const pipeline_record& b)
 				{
-					fs::dir_entry tmp = entries[pos];
+					return a.last_use > b.last_use;
+				});
+			}
+
+			if (open_archive(m_program_archive, root_path + "/raw/programs.bin", sizeof(program_record)))
+			{
+				std::vector<u8> blob;
+				m_program_archive.seek(0);
+				m_program_archive.read(blob, m_program_archive.size());
 
-					const auto filename = directory_path + "/" + tmp.name;
-					fs::file f(filename);
+				usz offset = sizeof(archive_header);
+				while (offset + sizeof(program_record) <= blob.size())
+				{
+					program_record header;
+					std::memcpy(&header, blob.data() + offset, sizeof(header));
 
-					if (!f)
+					if (header.type > fragment_program || offset + sizeof(header) + header.size > blob.size())
 					{
-						// Unexpected error, but avoid crash
-						continue;
+						break;
 					}
 
-					if (f.size() != sizeof(pipeline_data))
+					m_program_keys[header.type].insert(header.hash);
+					offset += sizeof(header) + header.size;
+				}
+
+				m_program_archive.trunc(offset);
+
+				if (read_contents)
+				{
+					m_program_blob = std::move(blob);
+
+					for (usz pos = sizeof(archive_header); pos < offset;)
 					{
-						rsx_log.error("Removing cached pipeline object %s since it's not binary compatible with the current shader cache", tmp.name.c_str());
-						fs::remove_file(filename);
-						continue;
+						program_record header;
+						std::memcpy(&header, m_program_blob.data() + pos, sizeof(header));
+						m_program_blob_index[header.type].emplace(header.hash, std::span<const u8>(m_program_blob.data() + pos + sizeof(header), header.size));
+						pos += sizeof(header) + header.size;
+					}
+				}
+			}
+
+			return records;
+		}
+
+		// Must be called with m_archive_mutex held. Known pipelines only get their last use updated
+		void append_pipeline(const pipeline_data& data, u64 last_use)
+		{
+			if (!m_pipeline_archive)
+			{
+				return;
+			}
+
+			const pipeline_record record{ get_pipeline_key(data), last_use, data };
+
+			if (const auto found = m_pipeline_keys.find(record.key); found != m_pipeline_keys.end())
+			{
+				if (found->second.last_use < last_use)
+				{
+					found->second.last_use = last_use;
+					m_pipeline_archive.seek(found->second.offset + offsetof(pipeline_record, last_use));
+					m_pipeline_archive.write(last_use);
+				}
+
+				return;
+			}
+
+			const u64 offset = m_pipeline_archive.seek(0, fs::seek_end);
+			m_pipeline_archive.write(record);
+			m_pipeline_keys.emplace(record.key, archived_pipeline{ offset, last_use });
+		}
+
+		// Must be called with m_archive_mutex held
+		void append_program(u32 type, u64 hash, const void* data, u32 size)
+		{
+			if (!m_program_archive || !size || !m_program_keys[type].insert(hash).second)
+			{
+				return;
+			}
+
+			const program_record header{ hash, type, size };
+			m_program_archive.seek(0, fs::seek_end);
+			m_program_archive.write(header);
+			m_program_archive.write(data, size);
+		}
+
+		// Move pipelines saved by older versions as one file per pipeline into the archive
+		void import_legacy_pipelines(std::vector<pipeline_record>& records)
+		{
+			const std::string directory_path = get_pipeline_directory();
+
+			for (auto&& tmp : fs::dir(directory_path))
+			{
+				if (tmp.is_directory || tmp.name == "pipelines.bin" || !tmp.name.ends_with(".bin"))
+					continue;
+
+				const auto filename = directory_path + "/" + tmp.name;
+
+				if (pipeline_data pdata{}; tmp.size == sizeof(pipeline_data) && fs::file(filename).read(pdata))
+				{
+					const u64 key = get_pipeline_key(pdata);
+
+					if (!m_pipeline_keys.contains(key))
+					{
+						append_pipeline(pdata, 0);
+						records.push_back({ key, 0, pdata });
 					}
+				}
 
-					pipeline_data pdata{};
-					f.read(&pdata, f.size());
+				fs::remove_file(filename);
+			}
+		}
 
-					auto entry = unpack(pdata);
+		void load_shaders(uint nb_workers, unpacked_type& unpacked, std::vector<pipeline_record>& records, u32 entry_count,
+		    shader_loading_dialog* dlg)
+		{
+			atomic_t<u32> processed(0);
+
+			std::function<void(u32)> shader_load_worker = [&](u32 stop_at)
+			{
+				u32 pos;
+				// Processed is incremented before work starts in order to avoid two workers working on the same shader
+				while (((pos = processed++) < stop_at) && !Emu.IsStopped())
+				{
+					auto entry = unpack(records[pos].data);
 
 					if (std::get<1>(entry).data.empty() || !std::get<2>(entry).ucode_length)
 					{
@@ -217,33 +455,24 @@ namespace rsx
 				return;
 			}
 
-			std::string directory_path = root_path + "/pipelines/" + pipeline_class_name + "/" + version_prefix;
-
-			fs::dir root = fs::dir(directory_path);
-
-			if (!root)
-			{
-				fs::create_path(directory_path);
-				fs::create_path(root_path + "/raw");
-				return;
-			}
-
-			std::vector<fs::dir_entry> entries;
+			const steady_clock::time_point load_start = steady_clock::now();
 
-			for (auto&& tmp : root)
+			std::vector<pipeline_record> records;
 			{
-				if (tmp.is_directory)
-					continue;
-
-				entries.push_back(tmp);
+				std::lock_guard lock(m_archive_mutex);
+				records = open_archives(true);
+				import_legacy_pipelines(records);
 			}
 
-			u32 entry_count = ::size32(entries);
+			u32 entry_count = ::size32(records);
 
 			if (!entry_count)
+			{
+				m_program_blob_index[vertex_program].clear();
+				m_program_blob_index[fragment_program].clear();
+				m_program_blob = {};
 				return;
-
-			root.rewind();
+			}
 
 			// Progress dialog
 			std::unique_ptr<shader_loading_dialog> fallback_dlg;
@@ -263,15 +492,30 @@ namespace rsx
 			unpacked_type unpacked;
 			uint nb_workers = g_cfg.video.renderer == video_renderer::vulkan ? utils::get_thread_count() : 1;
 
-			load_shaders(nb_workers, unpacked, directory_path, entries, entry_count, dlg);
+			load_shaders(nb_workers, unpacked, records, entry_count, dlg);
+
+			// The program archive contents are no longer needed
+			m_program_blob_index[vertex_program].clear();
+			m_program_blob_index[fragment_program].clear();
+			m_program_blob = {};
 
 			// Account for any invalid entries
 			entry_count = unpacked.size();
 
+			const steady_clock::time_point compile_start = steady_clock::now();
+
 			compile_shaders(nb_workers, unpacked, entry_count, dlg, std::forward<Args>(args)...);
 
+			const steady_clock::time_point compile_end = steady_clock::now();
+
 			dlg->refresh();
 			dlg->close();
+
+			const auto load_ms = std::chrono::duration_cast<std::chrono::milliseconds>(compile_start - load_start).count();
+			const auto compile_ms = std::chrono::duration_cast<std::chrono::milliseconds>(compile_end - compile_start).count();
+
+			rsx_log.notice("shaders_cache: Loaded %u pipelines in %dms (%.1f/s), compiled in %dms (%.1f/s) using %u workers",
+				entry_count, load_ms, entry_count * 1000. / std::max<s64>(load_ms, 1), compile_ms, entry_count * 1000. / std::max<s64>(compile_ms, 1), nb_workers);
 		}
 
 		void store(const pipeline_storage_type &pipeline, const RSXVertexProgram &vp, const RSXFragmentProgram &fp)
@@ -289,66 +533,73 @@ namespace rsx
 
 			pipeline_data data = pack(pipeline, vp, fp);
 
-			std::string fp_name = root_path + "/raw/" + fmt::format("%llX.fp", data.fragment_program_hash);
-			std::string vp_name = root_path + "/raw/" + fmt::format("%llX.vp", data.vertex_program_hash);
+			std::lock_guard lock(m_archive_mutex);
 
-			// Writeback to cache either if file does not exist or it is invalid (unexpected size)
-			// Note: fs::write_file is not atomic, if the process is terminated in the middle an empty file is created
-			if (fs::stat_t s{}; !fs::stat(fp_name, s) || s.size != fp.ucode_length)
-			{
-				fs::write_file(fp_name, fs::rewrite, fp.get_data(), fp.ucode_length);
-			}
-
-			if (fs::stat_t s{}; !fs::stat(vp_name, s) || s.size != vp.data.size() * sizeof(u32))
-			{
-				fs::write_file(vp_name, fs::rewrite, vp.data);
-			}
-
-			u64 state_hash = 0;
-			state_hash ^= rpcs3::hash_base<u32>(data.vp_ctrl);
-			state_hash ^= rpcs3::hash_base<u32>(data.fp_ctrl);
-			state_hash ^= rpcs3::hash_base<u32>(data.vp_texture_dimensions);
-			state_hash ^= rpcs3::hash_base<u32>(data.fp_texture_dimensions);
-			state_hash ^= rpcs3::hash_base<u32>(data.fp_texcoord_control);
-			state_hash ^= rpcs3::hash_base<u16>(data.fp_height);
-			state_hash ^= rpcs3::hash_base<u16>(data.fp_pixel_layout);
-			state_hash ^= rpcs3::hash_base<u16>(data.fp_lighting_flags);
-			state_hash ^= rpcs3::hash_base<u16>(data.fp_shadow_textures);
-			state_hash ^= rpcs3::hash_base<u16>(data.fp_redirected_textures);
-			state_hash ^= rpcs3::hash_base<u16>(data.vp_multisampled_textures);
-			state_hash ^= rpcs3::hash_base<u16>(data.fp_multisampled_textures);
+			open_archives(false);
 
-			const std::string pipeline_file_name = fmt::format("%llX+%llX+%llX+%llX.bin", data.vertex_program_hash, data.fragment_program_hash, data.pipeline_storage_hash, state_hash);
-			const std::string pipeline_path = root_path + "/pipelines/" + pipeline_class_name + "/" + version_prefix + "/" + pipeline_file_name;
-			fs::write_file(pipeline_path, fs::rewrite, &data, sizeof(data));
+			append_program(fragment_program, data.fragment_program_hash, fp.get_data(), fp.ucode_length);
+			append_program(vertex_program, data.vertex_program_hash, vp.data.data(), ::size32(vp.data) * sizeof(u32));
+			append_pipeline(data, m_session);
 		}
 
-		RSXVertexProgram load_vp_raw(u64 program_hash) const
+		RSXVertexProgram load_vp_raw(u64 program_hash)
 		{
 			RSXVertexProgram vp = {};
 
+			if (auto found = m_program_blob_index[vertex_program].find(program_hash); found != m_program_blob_index[vertex_program].end())
+			{
+				const auto& ucode = found->second;
+				vp.data.resize(ucode.size() / sizeof(u32));
+				std::memcpy(vp.data.data(), ucode.data(), vp.data.size() * sizeof(u32));
+				return vp;
+			}
+
+			// Programs saved by older versions
 			fs::file f(fmt::format("%s/raw/%llX.vp", root_path, program_hash));
 			if (f) f.read(vp.data, f.size() / sizeof(u32));
 
+			if (!vp.data.empty())
+			{
+				std::lock_guard lock(m_archive_mutex);
+				append_program(vertex_program, program_hash, vp.data.data(), ::size32(vp.data) * sizeof(u32));
+			}
+
 			return vp;
 		}
 
 		RSXFragmentProgram load_fp_raw(u64 program_hash)
 		{
-			fs::file f(fmt::format("%s/raw/%llX.fp", root_path, program_hash));
-
 			RSXFragmentProgram fp = {};
 
-			const u32 size = fp.ucode_length = f ? ::size32(f) : 0;
+			std::unique_ptr<u8[]> buf;
 
-			if (!size)
+			if (auto found = m_program_blob_index[fragment_program].find(program_hash); found != m_program_blob_index[fragment_program].end())
+			{
+				const auto& ucode = found->second;
+				fp.ucode_length = ::size32(ucode);
+				buf = std::make_unique<u8[]>(fp.ucode_length);
+				std::memcpy(buf.get(), ucode.data(), fp.ucode_length);
+			}
+			else
 			{
-				return fp;
+				// Programs saved by older versions
+				fs::file f(fmt::format("%s/raw/%llX.fp", root_path, program_hash));
+
+				const u32 size = fp.ucode_length = f ? ::size32(f) : 0;
+
+				if (!size)
+				{
+					return fp;
+				}
+
+				buf = std::make_unique<u8[]>(size);
+				f.read(buf.get(), size);
+
+				std::lock_guard lock(m_archive_mutex);
+				append_program(fragment_program, program_hash, buf.get(), size);
 			}
 
-			auto buf = std::make_unique<u8[]>(size);
 			fp.data = buf.get();
-			f.read(buf.get(), size);
 			fragment_program_data[fragment_program_data.push_begin()] = std::move(buf);
 			return fp;
 		}
@@ -13,6 +13,7 @@ namespace rsx
 	rsx_state method_registers;
 
 	std::array<rsx_method_t, 0x10000 / 4> methods{};
+	std::array<bool, 0x10000 / 4> methods_skip_on_match{};
 
 	void invalid_method(thread* rsx, u32 reg, u32 arg)
 	{
@@ -3467,6 +3468,66 @@ namespace rsx
 		bind(NV4097_SET_POLYGON_STIPPLE, nv4097::notify_state_changed<fragment_state_dirty>);
 		bind_array(NV4097_SET_POLYGON_STIPPLE_PATTERN, 1, 32, nv4097::notify_state_changed<polygon_stipple_pattern_dirty>);
 
+		// Rewriting the current value through these handlers is a no-op, allowing the FIFO to drop such writes
+		// Texture and surface bindings are excluded as their dirty bits also trigger memory revalidation
+		// Vertex base offsets are excluded as their handlers revert the register inside begin/end and queue a barrier instead
+		auto skip_on_match = [](u32 id, u32 step = 1, u32 count = 1)
+		{
+			ensure(step && count && id + u64{step} * (count - 1) < 0x10000 / 4);
+
+			for (u32 i = id; i < id + count * step; i += step)
+			{
+				methods_skip_on_match[i] = true;
+			}
+		};
+
+		skip_on_match(NV4097_SET_CULL_FACE);
+		skip_on_match(NV4097_SET_DEPTH_TEST_ENABLE);
+		skip_on_match(NV4097_SET_DEPTH_FUNC);
+		skip_on_match(NV4097_SET_DEPTH_MASK);
+		skip_on_match(NV4097_SET_COLOR_MASK);
+		skip_on_match(NV4097_SET_COLOR_MASK_MRT);
+		skip_on_match(NV4097_SET_STENCIL_TEST_ENABLE);
+		skip_on_match(NV4097_SET_TWO_SIDED_STENCIL_TEST_ENABLE);
+		skip_on_match(NV4097_SET_STENCIL_MASK);
+		skip_on_match(NV4097_SET_BACK_STENCIL_MASK);
+		skip_on_match(NV4097_SET_STENCIL_OP_ZPASS);
+		skip_on_match(NV4097_SET_STENCIL_OP_FAIL);
+		skip_on_match(NV4097_SET_STENCIL_OP_ZFAIL);
+		skip_on_match(NV4097_SET_BACK_STENCIL_OP_ZPASS);
+		skip_on_match(NV4097_SET_BACK_STENCIL_OP_FAIL);
+		skip_on_match(NV4097_SET_BACK_STENCIL_OP_ZFAIL);
+		skip_on_match(NV4097_SET_SHADER_CONTROL);
+		skip_on_match(NV4097_SET_TEX_COORD_CONTROL, 1, 10);
+		skip_on_match(NV4097_SET_TWO_SIDE_LIGHT_EN);
+		skip_on_match(NV4097_SET_POINT_SPRITE_CONTROL);
+		skip_on_match(NV4097_SET_TRANSFORM_PROGRAM_START);
+		skip_on_match(NV4097_SET_VERTEX_ATTRIB_OUTPUT_MASK);
+		skip_on_match(NV4097_SET_USER_CLIP_PLANE_CONTROL);
+		skip_on_match(NV4097_SET_TRANSFORM_BRANCH_BITS);
+		skip_on_match(NV4097_SET_CLIP_MIN);
+		skip_on_match(NV4097_SET_CLIP_MAX);
+		skip_on_match(NV4097_SET_POINT_SIZE);
+		skip_on_match(NV4097_SET_ALPHA_FUNC);
+		skip_on_match(NV4097_SET_ALPHA_REF);
+		skip_on_match(NV4097_SET_ALPHA_TEST_ENABLE);
+		skip_on_match(NV4097_SET_ANTI_ALIASING_CONTROL);
+		skip_on_match(NV4097_SET_SHADER_PACKER);
+		skip_on_match(NV4097_SET_SHADER_WINDOW);
+		skip_on_match(NV4097_SET_FOG_MODE);
+		skip_on_match(NV4097_SET_FOG_PARAMS, 1, 2);
+		skip_on_match(NV4097_SET_SCISSOR_HORIZONTAL);
+		skip_on_match(NV4097_SET_SCISSOR_VERTICAL);
+		skip_on_match(NV4097_SET_VIEWPORT_HORIZONTAL);
+		skip_on_match(NV4097_SET_VIEWPORT_VERTICAL);
+		skip_on_match(NV4097_SET_VIEWPORT_SCALE, 1, 3);
+		skip_on_match(NV4097_SET_VIEWPORT_OFFSET, 1, 3);
+		skip_on_match(NV4097_SET_BLEND_EQUATION);
+		skip_on_match(NV4097_SET_BLEND_FUNC_SFACTOR);
+		skip_on_match(NV4097_SET_BLEND_FUNC_DFACTOR);
+		skip_on_match(NV4097_SET_POLYGON_STIPPLE);
+		skip_on_match(NV4097_SET_POLYGON_STIPPLE_PATTERN, 1, 32);
+
 		//NV308A (0xa400..0xbffc!)
 		bind_array(NV308A_COLOR, 1, 256 * 7, nv308a::color::impl);
 
@@ -1663,4 +1663,5 @@ namespace rsx
 
 	extern rsx_state method_registers;
 	extern std::array<rsx_method_t, 0x10000 / 4> methods;
+	extern std::array<bool, 0x10000 / 4> methods_skip_on_match;
 }
@@ -25,6 +25,7 @@ extern "C"
 #endif
 
 #include "util/sysinfo.hpp"
+#include "util/image_scaler.hpp"
 
 namespace rsx
 {
@@ -33,6 +34,22 @@ namespace rsx
 	void convert_scale_image(u8 *dst, AVPixelFormat dst_format, int dst_width, int dst_height, int dst_pitch,
 		const u8 *src, AVPixelFormat src_format, int src_width, int src_height, int src_pitch, int src_slice_h, bool bilinear)
 	{
+		// Blits without a format conversion are handled in-tree, swscale remains the fallback for the rest
+		if (src_format == dst_format)
+		{
+			if (src_format == AV_PIX_FMT_ARGB &&
+				utils::scale_image_32(dst, dst_width, dst_height, dst_pitch, src, src_width, src_height, src_pitch, bilinear, src_slice_h))
+			{
+				return;
+			}
+
+			if (src_format == AV_PIX_FMT_RGB565BE && !bilinear &&
+				utils::scale_image_16(dst, dst_width, dst_height, dst_pitch, src, src_width, src_height, src_pitch, src_slice_h))
+			{
+				return;
+			}
+		}
+
 		std::unique_ptr<SwsContext, void(*)(SwsContext*)> sws(sws_getContext(src_width, src_height, src_format,
 			dst_width, dst_height, dst_format, bilinear ? SWS_FAST_BILINEAR : SWS_POINT, nullptr, nullptr, nullptr), sws_freeContext);
 
@@ -706,12 +706,11 @@ namespace rsx
 	{
 		// Converts a stream e.g [1, 2, 3, -1, 4, 5, 6] to a stream with degenerate splits
 		// Output is e.g [1, 2, 3, 3, 3, 4, 4, 5, 6] (5 bogus triangles)
-		T last_index{}, index;
+		T last_index{};
 		u32 dst_index = 0;
 		for (int n = 0; n < count;)
 		{
-			index = src[n];
-			if (index == restart_index)
+			if (src[n] == restart_index)
 			{
 				for (; n < count; ++n)
 				{
@@ -733,9 +732,14 @@ namespace rsx
 			}
 			else
 			{
-				dst[dst_index++] = index;
-				last_index = index;
-				++n;
+				// Copy the whole run up to the next restart index at once
+				const T* run_end = std::find(src + n, src + count, restart_index);
+				const int run_length = static_cast<int>(run_end - (src + n));
+
+				std::memcpy(dst + dst_index, src + n, run_length * sizeof(T));
+				dst_index += run_length;
+				last_index = run_end[-1];
+				n += run_length;
 			}
 		}
 
@@ -553,7 +553,7 @@ std::string Emulator::GetBackgroundPicturePath() const
 	return path;
 }
 
-bool Emulator::BootRsxCapture(const std::string& path)
+bool Emulator::BootRsxCapture(const std::string& path, u32 bench_iterations)
 {
 	fs::file in_file(path);
 
@@ -562,40 +562,67 @@ bool Emulator::BootRsxCapture(const std::string& path)
 		return false;
 	}
 
-	std::unique_ptr<rsx::frame_capture_data> frame = std::make_unique<rsx::frame_capture_data>();
-	utils::serial load;
-	load.set_reading_state();
-	in_file.read(load.data, in_file.size());
-	load.data.shrink_to_fit();
+	rsx::frame_capture_file_header header{};
 
-	load(*frame);
-	in_file.close();
+	if (!in_file.read(header))
+	{
+		sys_log.error("Invalid rsx capture file!");
+		return false;
+	}
 
-	if (frame->magic != rsx::c_fc_magic)
+	if (header.magic != rsx::c_fc_magic)
 	{
 		sys_log.error("Invalid rsx capture file!");
 		return false;
 	}
 
-	if (frame->version != rsx::c_fc_version)
+	if (header.version != rsx::c_fc_version)
 	{
-		sys_log.error("Rsx capture file version not supported! Expected %d, found %d", +rsx::c_fc_version, frame->version);
+		sys_log.error("Rsx capture file version not supported! Expected %d, found %d", +rsx::c_fc_version, header.version);
 		return false;
 	}
 
-	if (frame->LE_format != u32{std::endian::little == std::endian::native})
+	if (header.LE_format != u32{std::endian::little == std::endian::native})
 	{
 		static constexpr std::string_view machines[2]{"Big-Endian", "Little-Endian"};
 
 		sys_log.error("Rsx capture byte endianness not supported! Expected %s format, found %s format"
-			, machines[frame->LE_format ^ 1], machines[frame->LE_format]);
+			, machines[header.LE_format ^ 1], machines[header.LE_format]);
+
+		return false;
+	}
 
+	if (header.metadata_offset < sizeof(header) || header.metadata_offset > in_file.size())
+	{
+		sys_log.error("Invalid rsx capture file! (metadata offset 0x%x is out of range, file size=0x%x)", header.metadata_offset, in_file.size());
+		return false;
+	}
+
+	// Only the metadata is loaded up front, memory blocks are streamed by the replay thread
+	std::unique_ptr<rsx::frame_capture_data> frame = std::make_unique<rsx::frame_capture_data>();
+	utils::serial load;
+	load.set_reading_state();
+	in_file.seek(header.metadata_offset);
+	in_file.read(load.data, in_file.size() - header.metadata_offset);
+	load.data.shrink_to_fit();
+
+	if (!load(*frame))
+	{
+		sys_log.error("Invalid rsx capture file!");
 		return false;
 	}
 
 	Init();
 	g_cfg.video.disable_on_disk_shader_cache.set(true);
 
+	if (bench_iterations)
+	{
+		// Headless benchmark: replay as fast as possible on the CPU only
+		g_cfg.video.renderer.set(video_renderer::null);
+		g_cfg.video.frame_limit.set(frame_limit_type::none);
+		g_cfg.video.frontend_profiling.set(true);
+	}
+
 	vm::init();
 	g_fxo->init(false);
 
@@ -615,7 +642,7 @@ bool Emulator::BootRsxCapture(const std::string& path)
 	GetCallbacks().on_run(false);
 	m_state = system_state::starting;
 
-	ensure(g_fxo->init<named_thread<rsx::rsx_replay_thread>>("RSX Replay", std::move(frame)));
+	ensure(g_fxo->init<named_thread<rsx::rsx_replay_thread>>("RSX Replay", std::move(frame), std::move(in_file), bench_iterations));
 
 	return true;
 }
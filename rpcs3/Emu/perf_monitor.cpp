@@ -2,6 +2,10 @@
 #include "perf_monitor.hpp"
 #include "util/cpu_stats.hpp"
 #include "Utilities/Thread.h"
+#include "Emu/IdManager.h"
+#include "Emu/Cell/PPUThread.h"
+#include "Emu/Cell/SPUThread.h"
+#include "Emu/RSX/RSXThread.h"
 
 LOG_CHANNEL(sys_log, "SYS");
 
@@ -48,3 +52,25 @@ void perf_monitor::operator()()
 perf_monitor::~perf_monitor()
 {
 }
+
+thread_cycle_sampler::totals thread_cycle_sampler::sample()
+{
+	std::lock_guard lock(m_mutex);
+
+	m_totals.ppu_count = idm::select<named_thread<ppu_thread>>([this](u32, named_thread<ppu_thread>& ppu)
+	{
+		m_totals.ppu_cycles += thread_ctrl::get_cycles(ppu);
+	});
+
+	m_totals.spu_count = idm::select<named_thread<spu_thread>>([this](u32, named_thread<spu_thread>& spu)
+	{
+		m_totals.spu_cycles += thread_ctrl::get_cycles(spu);
+	});
+
+	if (auto rsx = rsx::get_current_renderer())
+	{
+		m_totals.rsx_cycles += rsx->get_cycles();
+	}
+
+	return m_totals;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "util/types.hpp"
+#include "Utilities/mutex.h"
 
 struct perf_monitor
 {
@@ -9,3 +10,23 @@ struct perf_monitor
 
 	static constexpr auto thread_name = "Performance Sensor"sv;
 };
+
+// Thread cycle counters are reset on read, so every consumer goes through this object instead of calling get_cycles directly.
+// Totals only grow; consumers keep their previous sample and take their own deltas.
+struct thread_cycle_sampler
+{
+	struct totals
+	{
+		u64 ppu_cycles = 0;
+		u64 spu_cycles = 0;
+		u64 rsx_cycles = 0;
+		u32 ppu_count = 0;
+		u32 spu_count = 0;
+	};
+
+	totals sample();
+
+private:
+	shared_mutex m_mutex;
+	totals m_totals{};
+};
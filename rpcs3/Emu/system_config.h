@@ -56,6 +56,7 @@ struct cfg_root : cfg::node
 		};
 
 		fifo_setting rsx_fifo_accuracy{this, "RSX FIFO Accuracy", rsx_fifo_mode::fast };
+		cfg::_bool rsx_fifo_predecoding{ this, "RSX FIFO Pre-decoding", false }; // Decode FIFO ahead of the RSX thread, fast FIFO accuracy only
 		cfg::_bool spu_verification{ this, "SPU Verification", true }; // Should be enabled
 		cfg::_bool spu_cache{ this, "SPU Cache", true };
 		cfg::_bool spu_prof{ this, "SPU Profiler", false };
@@ -95,6 +96,8 @@ struct cfg_root : cfg::node
 		cfg::_enum<sleep_timers_accuracy_level> sleep_timers_accuracy{ this, "Sleep Timers Accuracy", sleep_timers_accuracy_level::_usleep, true };
 #endif
 
+		cfg::uint<0, 256> font_glyph_cache_size{ this, "Font Glyph Cache Size", 4, true }; // In MiB, rasterized cellFont glyphs, 0 disables the cache
+
 		cfg::uint64 perf_report_threshold{this, "Performance Report Threshold", 500, true}; // In µs, 0.5ms = default, 0 = everything
 		cfg::_bool perf_report{this, "Enable Performance Report", false, true}; // Show certain perf-related logs
 		cfg::_bool external_debugger{this, "Assume External Debugger"};
@@ -146,6 +149,7 @@ struct cfg_root : cfg::node
 		cfg::_bool disable_video_output{ this, "Disable Video Output", false, true };
 		cfg::_bool disable_vertex_cache{ this, "Disable Vertex Cache", false };
 		cfg::_bool disable_FIFO_reordering{ this, "Disable FIFO Reordering", false };
+		cfg::_bool skip_redundant_register_writes{ this, "Skip Redundant Register Writes", false };
 		cfg::_bool frame_skip_enabled{ this, "Enable Frame Skip", false, true };
 		cfg::_bool force_cpu_blit_processing{ this, "Force CPU Blit", false, true }; // Debugging option
 		cfg::_bool disable_on_disk_shader_cache{ this, "Disable On-Disk Shader Cache", false };
@@ -158,9 +162,15 @@ struct cfg_root : cfg::node
 		cfg::_bool disable_native_float16{ this, "Disable native float16 support", false };
 #endif
 		cfg::_bool multithreaded_rsx{ this, "Multithreaded RSX", false };
+		cfg::uint<1, 8> offload_worker_count{ this, "RSX Offload Workers", 2 }; // Transfer threads used by Multithreaded RSX
+		cfg::uint<0, 16> vdec_thread_count{ this, "Video Decoder Threads", 0 }; // ffmpeg threads per cellVdec instance, 0 uses slice threading only with a count picked from the host cores
 		cfg::_bool relaxed_zcull_sync{ this, "Relaxed ZCULL Sync", false };
 		cfg::_bool enable_3d{ this, "Enable 3D", false };
 		cfg::_bool debug_program_analyser{ this, "Debug Program Analyser", false };
+		cfg::_bool frontend_profiling{ this, "RSX Frontend Profiling", false }; // Collect frontend timings every frame, the Null renderer also prepares draw data on the CPU
+		cfg::_enum<cache_telemetry_format> cache_telemetry{ this, "Cache Telemetry Export", cache_telemetry_format::disabled }; // Per-frame texture cache statistics written to the cache directory
+		cfg::_bool frame_time_recording{ this, "Record Frame Times", false }; // Per-frame phase timings written to the cache directory, percentiles logged on exit
+		cfg::uint<1, 600> frame_capture_count{ this, "Frame Capture Count", 1, true }; // Number of consecutive frames recorded per RSX capture
 		cfg::_bool precise_zpass_count{ this, "Accurate ZCULL stats", true };
 		cfg::_int<1, 8> consecutive_frames_to_draw{ this, "Consecutive Frames To Draw", 1, true};
 		cfg::_int<1, 8> consecutive_frames_to_skip{ this, "Consecutive Frames To Skip", 1, true};
@@ -257,6 +267,7 @@ struct cfg_root : cfg::node
 		cfg::_int<0, 200> volume{ this, "Master Volume", 100, true };
 		cfg::_bool enable_buffering{ this, "Enable Buffering", true, true };
 		cfg::_int <4, 250> desired_buffer_duration{ this, "Desired Audio Buffer Duration", 100, true };
+		cfg::_bool adaptive_buffering{ this, "Adaptive Buffering", false, true }; // Follow the measured backend jitter, using the desired duration as the upper bound
 		cfg::_bool enable_time_stretching{ this, "Enable Time Stretching", false, true };
 		cfg::_int<0, 100> time_stretching_threshold{ this, "Time Stretching Threshold", 75, true };
 		cfg::_enum<microphone_handler> microphone_type{ this, "Microphone Type", microphone_handler::null };
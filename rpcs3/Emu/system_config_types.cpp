@@ -319,6 +319,22 @@ void fmt_class_string<frame_limit_type>::format(std::string& out, u64 arg)
 	});
 }
 
+template <>
+void fmt_class_string<cache_telemetry_format>::format(std::string& out, u64 arg)
+{
+	format_enum(out, arg, [](cache_telemetry_format value)
+	{
+		switch (value)
+		{
+		case cache_telemetry_format::disabled: return "Disabled";
+		case cache_telemetry_format::csv: return "CSV";
+		case cache_telemetry_format::json: return "JSON";
+		}
+
+		return unknown;
+	});
+}
+
 template <>
 void fmt_class_string<microphone_handler>::format(std::string& out, u64 arg)
 {
@@ -195,6 +195,13 @@ enum class frame_limit_type
 	infinite,
 };
 
+enum class cache_telemetry_format
+{
+	disabled,
+	csv,
+	json,
+};
+
 enum class msaa_level
 {
 	none,
@@ -279,6 +279,8 @@ constexpr auto arg_savestate    = "savestate";
 constexpr auto arg_timer        = "high-res-timer";
 constexpr auto arg_verbose_curl = "verbose-curl";
 constexpr auto arg_any_location = "allow-any-location";
+constexpr auto arg_rsx_bench    = "rsx-bench";
+constexpr auto arg_iterations   = "iterations";
 
 int find_arg(std::string arg, int& argc, char* argv[])
 {
@@ -293,7 +295,8 @@ QCoreApplication* create_application(int& argc, char* argv[])
 {
 	if (find_arg(arg_headless, argc, argv) != -1 ||
 		find_arg(arg_decrypt, argc, argv) != -1 ||
-		find_arg(arg_commit_db, argc, argv) != -1)
+		find_arg(arg_commit_db, argc, argv) != -1 ||
+		find_arg(arg_rsx_bench, argc, argv) != -1)
 	{
 		return new headless_application(argc, argv);
 	}
@@ -623,6 +626,9 @@ int main(int argc, char** argv)
 	parser.addOption(QCommandLineOption(arg_timer, "Enable high resolution timer for better performance (windows)", "enabled", "1"));
 	parser.addOption(QCommandLineOption(arg_verbose_curl, "Enable verbose curl logging."));
 	parser.addOption(QCommandLineOption(arg_any_location, "Allow RPCS3 to be run from any location. Dangerous"));
+	const QCommandLineOption rsx_bench_option(arg_rsx_bench, "Replay an RSX capture headlessly on the Null renderer and report frontend timings.", "path", "");
+	parser.addOption(rsx_bench_option);
+	parser.addOption(QCommandLineOption(arg_iterations, "Number of replays for --rsx-bench.", "count", "10"));
 	parser.process(app->arguments());
 
 	// Don't start up the full rpcs3 gui if we just want the version or help.
@@ -1082,7 +1088,34 @@ int main(int argc, char** argv)
 		sys_log.notice("Option passed via command line: %s %s", opt.toStdString(), parser.value(opt).toStdString());
 	}
 
-	if (parser.isSet(arg_savestate))
+	if (parser.isSet(arg_rsx_bench))
+	{
+		const std::string capture_path = parser.value(rsx_bench_option).toStdString();
+
+		bool ok = false;
+		const u32 iterations = parser.value(arg_iterations).toUInt(&ok);
+
+		if (!ok || !iterations)
+		{
+			report_fatal_error(fmt::format("Invalid value for --%s: %s", arg_iterations, parser.value(arg_iterations).toStdString()));
+		}
+
+		if (!fs::is_file(capture_path))
+		{
+			report_fatal_error(fmt::format("No RSX capture file found: %s", capture_path));
+		}
+
+		sys_log.notice("Benchmarking RSX capture from command line: %s (%u iterations)", capture_path, iterations);
+
+		Emu.CallFromMainThread([path = capture_path, iterations]()
+		{
+			if (!Emu.BootRsxCapture(path, iterations))
+			{
+				report_fatal_error(fmt::format("Booting RSX capture '%s' failed!", path));
+			}
+		});
+	}
+	else if (parser.isSet(arg_savestate))
 	{
 		const std::string savestate_path = parser.value(savestate_option).toStdString();
 		sys_log.notice("Booting savestate from command line: %s", savestate_path);
@@ -0,0 +1,433 @@
+#include "stdafx.h"
+#include "image_scaler.hpp"
+
+#if defined(ARCH_X64)
+#include "emmintrin.h"
+#endif
+
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#endif
+
+#ifdef ARCH_ARM64
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif
+#undef FORCE_INLINE
+#include "Emu/CPU/sse2neon.h"
+#endif
+
+namespace
+{
+	// BT.601 limited range coefficients in 6 bit fixed point, matching swscale's default matrix
+	constexpr s16 coef_y = 74;   // 1.164
+	constexpr s16 coef_rv = 102; // 1.596
+	constexpr s16 coef_gu = 25;  // 0.391
+	constexpr s16 coef_gv = 52;  // 0.813
+	constexpr s16 coef_bu = 129; // 2.018
+
+	inline u8 clamp_u8(int value)
+	{
+		return static_cast<u8>(std::clamp(value, 0, 255));
+	}
+
+	inline void yuv_to_rgb_scalar(u8 y, u8 u, u8 v, u8& r, u8& g, u8& b)
+	{
+		const int c = (y - 16) * coef_y + 32;
+		const int d = u - 128;
+		const int e = v - 128;
+
+		r = clamp_u8((c + coef_rv * e) >> 6);
+		g = clamp_u8((c - coef_gu * d - coef_gv * e) >> 6);
+		b = clamp_u8((c + coef_bu * d) >> 6);
+	}
+
+	inline void store_pixel(u8* dst, u8 r, u8 g, u8 b, u8 a, utils::rgba32_order order)
+	{
+		if (order == utils::rgba32_order::rgba)
+		{
+			dst[0] = r; dst[1] = g; dst[2] = b; dst[3] = a;
+		}
+		else
+		{
+			dst[0] = a; dst[1] = r; dst[2] = g; dst[3] = b;
+		}
+	}
+
+	// 8 pixels of Y with their (already upsampled) chroma, as signed 16 bit lanes
+	inline void yuv_to_rgb_x8(__m128i y, __m128i u, __m128i v, __m128i& r, __m128i& g, __m128i& b)
+	{
+		const __m128i c = _mm_add_epi16(_mm_mullo_epi16(_mm_sub_epi16(y, _mm_set1_epi16(16)), _mm_set1_epi16(coef_y)), _mm_set1_epi16(32));
+		const __m128i d = _mm_sub_epi16(u, _mm_set1_epi16(128));
+		const __m128i e = _mm_sub_epi16(v, _mm_set1_epi16(128));
+
+		// Saturating math, anything that clips here also clips when packed to 8 bits
+		r = _mm_srai_epi16(_mm_adds_epi16(c, _mm_mullo_epi16(e, _mm_set1_epi16(coef_rv))), 6);
+		g = _mm_srai_epi16(_mm_subs_epi16(_mm_subs_epi16(c, _mm_mullo_epi16(d, _mm_set1_epi16(coef_gu))), _mm_mullo_epi16(e, _mm_set1_epi16(coef_gv))), 6);
+		b = _mm_srai_epi16(_mm_adds_epi16(c, _mm_mullo_epi16(d, _mm_set1_epi16(coef_bu))), 6);
+	}
+
+	// Center sampled source coordinate for nearest neighbour scaling
+	inline int point_coord(int dst, int src_size, int dst_size)
+	{
+		return static_cast<int>((static_cast<s64>(dst) * 2 + 1) * src_size / (static_cast<s64>(dst_size) * 2));
+	}
+
+	template <typename T>
+	void scale_point(u8* dst, int dst_width, int dst_height, int dst_pitch, const u8* src, int src_width, int src_height, int src_pitch, int src_rows)
+	{
+		if (src_width == dst_width && src_height == dst_height)
+		{
+			for (int y = 0; y < std::min(dst_height, src_rows); ++y)
+			{
+				std::memcpy(dst + y * dst_pitch, src + y * src_pitch, dst_width * sizeof(T));
+			}
+
+			return;
+		}
+
+		std::vector<u32> columns(dst_width);
+		for (int x = 0; x < dst_width; ++x)
+		{
+			columns[x] = point_coord(x, src_width, dst_width);
+		}
+
+		int last_row = -1;
+
+		for (int y = 0; y < dst_height; ++y)
+		{
+			u8* out = dst + y * dst_pitch;
+			const int row = point_coord(y, src_height, dst_height);
+
+			if (row >= src_rows)
+			{
+				// Outside of the provided slice
+				break;
+			}
+
+			if (row == last_row)
+			{
+				// Vertical upscale, duplicate the previous output line
+				std::memcpy(out, out - dst_pitch, dst_width * sizeof(T));
+				continue;
+			}
+
+			last_row = row;
+			const u8* in = src + row * src_pitch;
+
+			for (int x = 0; x < dst_width; ++x)
+			{
+				std::memcpy(out + x * sizeof(T), in + columns[x] * sizeof(T), sizeof(T));
+			}
+		}
+	}
+
+	struct bilinear_tap
+	{
+		int index;
+		int next;
+		u16 weight; // 0-256, weight of 'next'
+	};
+
+	bilinear_tap make_tap(int dst, int src_size, int dst_size)
+	{
+		// Pixel centers are aligned like swscale does
+		const f64 pos = std::max(0., (dst + 0.5) * src_size / dst_size - 0.5);
+		const int index = std::min(static_cast<int>(pos), src_size - 1);
+		const int next = std::min(index + 1, src_size - 1);
+		const u16 weight = next == index ? 0 : static_cast<u16>((pos - index) * 256. + 0.5);
+		return { index, next, weight };
+	}
+
+	void scale_bilinear_32(u8* dst, int dst_width, int dst_height, int dst_pitch, const u8* src, int src_width, int src_height, int src_pitch, int src_rows)
+	{
+		std::vector<bilinear_tap> columns(dst_width);
+		std::vector<u32> column_weights(dst_width);
+
+		for (int x = 0; x < dst_width; ++x)
+		{
+			columns[x] = make_tap(x, src_width, dst_width);
+
+			// Packed as (left, right) 16 bit pairs for pmaddwd
+			const u32 w1 = columns[x].weight;
+			column_weights[x] = (256 - w1) | (w1 << 16);
+		}
+
+		const __m128i zero = _mm_setzero_si128();
+		const int row_bytes = src_width * 4;
+
+		// Vertically blended source line
+		std::vector<u8> blended(row_bytes);
+
+		for (int y = 0; y < dst_height; ++y)
+		{
+			auto row = make_tap(y, src_height, dst_height);
+
+			if (row.index >= src_rows)
+			{
+				// Outside of the provided slice
+				break;
+			}
+
+			if (row.next >= src_rows)
+			{
+				row.next = row.index;
+				row.weight = 0;
+			}
+
+			const u8* in0 = src + row.index * src_pitch;
+			const u8* in1 = src + row.next * src_pitch;
+			u8* out = dst + y * dst_pitch;
+
+			const u8* line = in0;
+
+			if (row.weight)
+			{
+				const __m128i wy0 = _mm_set1_epi16(static_cast<s16>(256 - row.weight));
+				const __m128i wy1 = _mm_set1_epi16(static_cast<s16>(row.weight));
+
+				// Products stay below 2^16 so unsigned wraparound never happens
+				const auto blend = [&](__m128i top, __m128i bottom)
+				{
+					return _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(top, wy0), _mm_mullo_epi16(bottom, wy1)), 8);
+				};
+
+				int i = 0;
+				for (; i + 16 <= row_bytes; i += 16)
+				{
+					const __m128i top = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in0 + i));
+					const __m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in1 + i));
+					const __m128i lo = blend(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));
+					const __m128i hi = blend(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(blended.data() + i), _mm_packus_epi16(lo, hi));
+				}
+
+				for (; i < row_bytes; ++i)
+				{
+					blended[i] = static_cast<u8>((in0[i] * (256 - row.weight) + in1[i] * row.weight) >> 8);
+				}
+
+				line = blended.data();
+			}
+
+			// Interleaves the channels of the left and right texels and applies the horizontal weights
+			const auto filter = [&](int x)
+			{
+				const auto& col = columns[x];
+				u32 left, right;
+				std::memcpy(&left, line + col.index * 4, 4);
+				std::memcpy(&right, line + col.next * 4, 4);
+
+				const __m128i texels = _mm_unpacklo_epi8(_mm_unpacklo_epi8(_mm_cvtsi32_si128(left), _mm_cvtsi32_si128(right)), zero);
+				return _mm_srli_epi32(_mm_madd_epi16(texels, _mm_set1_epi32(column_weights[x])), 8);
+			};
+
+			int x = 0;
+			for (; x + 4 <= dst_width; x += 4)
+			{
+				const __m128i p01 = _mm_packs_epi32(filter(x), filter(x + 1));
+				const __m128i p23 = _mm_packs_epi32(filter(x + 2), filter(x + 3));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x * 4), _mm_packus_epi16(p01, p23));
+			}
+
+			for (; x < dst_width; ++x)
+			{
+				const u32 pixel = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(filter(x), zero), zero));
+				std::memcpy(out + x * 4, &pixel, 4);
+			}
+		}
+	}
+}
+
+namespace utils
+{
+	bool scale_image_32(u8* dst, int dst_width, int dst_height, int dst_pitch,
+		const u8* src, int src_width, int src_height, int src_pitch, bool bilinear, int src_rows)
+	{
+		if (dst_width <= 0 || dst_height <= 0 || src_width <= 0 || src_height <= 0)
+		{
+			return false;
+		}
+
+		src_rows = src_rows > 0 ? std::min(src_rows, src_height) : src_height;
+
+		if (bilinear && (src_width != dst_width || src_height != dst_height))
+		{
+			scale_bilinear_32(dst, dst_width, dst_height, dst_pitch, src, src_width, src_height, src_pitch, src_rows);
+		}
+		else
+		{
+			scale_point<u32>(dst, dst_width, dst_height, dst_pitch, src, src_width, src_height, src_pitch, src_rows);
+		}
+
+		return true;
+	}
+
+	bool scale_image_16(u8* dst, int dst_width, int dst_height, int dst_pitch,
+		const u8* src, int src_width, int src_height, int src_pitch, int src_rows)
+	{
+		if (dst_width <= 0 || dst_height <= 0 || src_width <= 0 || src_height <= 0)
+		{
+			return false;
+		}
+
+		src_rows = src_rows > 0 ? std::min(src_rows, src_height) : src_height;
+
+		scale_point<u16>(dst, dst_width, dst_height, dst_pitch, src, src_width, src_height, src_pitch, src_rows);
+		return true;
+	}
+
+	bool convert_yuv420_to_rgba32(u8* dst, int dst_pitch, const yuv420_planes& src, int width, int height, u8 alpha, rgba32_order order)
+	{
+		if (width <= 0 || height <= 0 || !src.y || !src.u || !src.v)
+		{
+			return false;
+		}
+
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i a8 = _mm_set1_epi8(static_cast<s8>(alpha));
+
+		for (int y = 0; y < height; ++y)
+		{
+			const u8* in_y = src.y + y * src.y_pitch;
+			const u8* in_u = src.u + (y / 2) * src.uv_pitch;
+			const u8* in_v = src.v + (y / 2) * src.uv_pitch;
+			u8* out = dst + y * dst_pitch;
+
+			int x = 0;
+
+			for (; x + 16 <= width; x += 16)
+			{
+				const __m128i y8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in_y + x));
+				const __m128i u8_ = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in_u + x / 2));
+				const __m128i v8_ = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in_v + x / 2));
+
+				// Horizontal chroma upsampling by duplication
+				const __m128i u16_ = _mm_unpacklo_epi8(u8_, u8_);
+				const __m128i v16_ = _mm_unpacklo_epi8(v8_, v8_);
+
+				__m128i r_lo, g_lo, b_lo, r_hi, g_hi, b_hi;
+				yuv_to_rgb_x8(_mm_unpacklo_epi8(y8, zero), _mm_unpacklo_epi8(u16_, zero), _mm_unpacklo_epi8(v16_, zero), r_lo, g_lo, b_lo);
+				yuv_to_rgb_x8(_mm_unpackhi_epi8(y8, zero), _mm_unpackhi_epi8(u16_, zero), _mm_unpackhi_epi8(v16_, zero), r_hi, g_hi, b_hi);
+
+				const __m128i r8 = _mm_packus_epi16(r_lo, r_hi);
+				const __m128i g8 = _mm_packus_epi16(g_lo, g_hi);
+				const __m128i b8 = _mm_packus_epi16(b_lo, b_hi);
+
+				__m128i c0, c1, c2, c3;
+				if (order == rgba32_order::rgba)
+				{
+					c0 = r8; c1 = g8; c2 = b8; c3 = a8;
+				}
+				else
+				{
+					c0 = a8; c1 = r8; c2 = g8; c3 = b8;
+				}
+
+				const __m128i lo01 = _mm_unpacklo_epi8(c0, c1);
+				const __m128i lo23 = _mm_unpacklo_epi8(c2, c3);
+				const __m128i hi01 = _mm_unpackhi_epi8(c0, c1);
+				const __m128i hi23 = _mm_unpackhi_epi8(c2, c3);
+
+				__m128i* out_vec = reinterpret_cast<__m128i*>(out + x * 4);
+				_mm_storeu_si128(out_vec + 0, _mm_unpacklo_epi16(lo01, lo23));
+				_mm_storeu_si128(out_vec + 1, _mm_unpackhi_epi16(lo01, lo23));
+				_mm_storeu_si128(out_vec + 2, _mm_unpacklo_epi16(hi01, hi23));
+				_mm_storeu_si128(out_vec + 3, _mm_unpackhi_epi16(hi01, hi23));
+			}
+
+			for (; x < width; ++x)
+			{
+				u8 r, g, b;
+				yuv_to_rgb_scalar(in_y[x], in_u[x / 2], in_v[x / 2], r, g, b);
+				store_pixel(out + x * 4, r, g, b, alpha, order);
+			}
+		}
+
+		return true;
+	}
+
+	bool convert_scale_yuv420_to_rgba32(u8* dst, int dst_width, int dst_height, int dst_pitch,
+		const yuv420_planes& src, int src_width, int src_height, u8 alpha, rgba32_order order, bool bilinear, std::vector<u8>& scratch)
+	{
+		if (src_width == dst_width && src_height == dst_height)
+		{
+			return convert_yuv420_to_rgba32(dst, dst_pitch, src, src_width, src_height, alpha, order);
+		}
+
+		if (src_width <= 0 || src_height <= 0)
+		{
+			return false;
+		}
+
+		const int scratch_pitch = src_width * 4;
+		scratch.resize(static_cast<usz>(scratch_pitch) * src_height);
+
+		return convert_yuv420_to_rgba32(scratch.data(), scratch_pitch, src, src_width, src_height, alpha, order) &&
+			scale_image_32(dst, dst_width, dst_height, dst_pitch, scratch.data(), src_width, src_height, scratch_pitch, bilinear);
+	}
+
+	bool convert_rgba32(u8* dst, int dst_width, int height, int dst_pitch, const u8* src, int src_width, rgba32_order order, bool flip)
+	{
+		if (dst_width <= 0 || height <= 0 || dst_width > src_width)
+		{
+			return false;
+		}
+
+		for (int y = 0; y < height; ++y)
+		{
+			const u8* in = src + static_cast<usz>(flip ? height - y - 1 : y) * src_width * 4;
+			u8* out = dst + static_cast<usz>(y) * dst_pitch;
+
+			if (order == rgba32_order::rgba)
+			{
+				std::memcpy(out, in, dst_width * 4);
+				continue;
+			}
+
+			int x = 0;
+
+			// Rotate every pixel so that alpha becomes the first byte
+			for (; x + 4 <= dst_width; x += 4)
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + x * 4));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x * 4), _mm_or_si128(_mm_slli_epi32(v, 8), _mm_srli_epi32(v, 24)));
+			}
+
+			for (; x < dst_width; ++x)
+			{
+				store_pixel(out + x * 4, in[x * 4 + 0], in[x * 4 + 1], in[x * 4 + 2], in[x * 4 + 3], order);
+			}
+		}
+
+		return true;
+	}
+
+	bool convert_rgba32_to_rgb24(u8* dst, int dst_width, int height, int dst_pitch, const u8* src, int src_width, bool flip)
+	{
+		if (dst_width <= 0 || height <= 0 || dst_width > src_width)
+		{
+			return false;
+		}
+
+		for (int y = 0; y < height; ++y)
+		{
+			const u8* in = src + static_cast<usz>(flip ? height - y - 1 : y) * src_width * 4;
+			u8* out = dst + static_cast<usz>(y) * dst_pitch;
+
+			for (int x = 0; x < dst_width; ++x)
+			{
+				out[x * 3 + 0] = in[x * 4 + 0];
+				out[x * 3 + 1] = in[x * 4 + 1];
+				out[x * 3 + 2] = in[x * 4 + 2];
+			}
+		}
+
+		return true;
+	}
+}
+
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "util/types.hpp"
+
+#include <vector>
+
+// In-tree converters for the few pixel format pairs used by the RSX blit engine, cellVdec, cellVpost and the image decoders.
+// Every entry point returns false when it cannot handle the request so callers can fall back to swscale.
+namespace utils
+{
+	enum class rgba32_order
+	{
+		rgba, // R, G, B, A in memory
+		argb, // A, R, G, B in memory
+	};
+
+	struct yuv420_planes
+	{
+		const u8* y;
+		const u8* u;
+		const u8* v;
+		int y_pitch;
+		int uv_pitch;
+	};
+
+	// Scales a 4 bytes per pixel image, channel order is preserved.
+	// Like a swscale slice, only src_rows lines of the source are read (0 for all) and only the output lines they cover are written.
+	bool scale_image_32(u8* dst, int dst_width, int dst_height, int dst_pitch,
+		const u8* src, int src_width, int src_height, int src_pitch, bool bilinear, int src_rows = 0);
+
+	// Nearest neighbour scale for 2 bytes per pixel images
+	bool scale_image_16(u8* dst, int dst_width, int dst_height, int dst_pitch,
+		const u8* src, int src_width, int src_height, int src_pitch, int src_rows = 0);
+
+	// Limited range BT.601 YUV 4:2:0 to 32 bit RGB with a constant alpha
+	bool convert_yuv420_to_rgba32(u8* dst, int dst_pitch, const yuv420_planes& src, int width, int height, u8 alpha, rgba32_order order);
+
+	// Converts and then scales to the requested size, scratch is reused between calls
+	bool convert_scale_yuv420_to_rgba32(u8* dst, int dst_width, int dst_height, int dst_pitch,
+		const yuv420_planes& src, int src_width, int src_height, u8 alpha, rgba32_order order, bool bilinear, std::vector<u8>& scratch);
+
+	// Stores the first dst_width pixels of every line of a packed RGBA image in the requested order.
+	// With flip the lines are stored bottom to top.
+	bool convert_rgba32(u8* dst, int dst_width, int height, int dst_pitch, const u8* src, int src_width, rgba32_order order, bool flip);
+
+	// Same as above but drops the alpha channel
+	bool convert_rgba32_to_rgb24(u8* dst, int dst_width, int height, int dst_pitch, const u8* src, int src_width, bool flip);
+}
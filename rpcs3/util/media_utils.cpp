@@ -5,6 +5,7 @@
 #include "Emu/Cell/Modules/cellSearch.h"
 #include "Emu/System.h"
 
+#include <chrono>
 #include <random>
 
 #ifdef _MSC_VER
@@ -198,6 +199,9 @@ namespace utils
 		}
 	};
 
+	// Upper bound for reserving a decoded track up front (about 23 minutes of 48kHz stereo float)
+	constexpr u64 max_reserved_size = 512 * 1024 * 1024;
+
 	audio_decoder::audio_decoder()
 	{
 	}
@@ -243,6 +247,43 @@ namespace utils
 		clear();
 	}
 
+	void audio_decoder::update_read_stats(u64 read_pos)
+	{
+		if (track_fully_decoded)
+		{
+			return;
+		}
+
+		const u64 lead = m_size - std::min<u64>(read_pos, m_size);
+
+		if (lead == 0)
+		{
+			m_reader_stalls++;
+		}
+
+		m_min_read_lead.fetch_op([lead](u64& value)
+		{
+			value = std::min(value, lead);
+		});
+	}
+
+	void audio_decoder::log_track_stats(const std::string& path)
+	{
+		const u64 size = m_size;
+		const u64 decode_time_us = std::max<u64>(m_decode_time_us, 1);
+		const u64 min_lead = m_min_read_lead;
+		const f64 bytes_per_ms = sample_rate * 2 * sizeof(f32) / 1000.;
+
+		media_log.notice("audio_decoder: decoded %s: %d frames, %d bytes in %d ms (%.1fx realtime), min lead %s, reader stalls %d",
+			path, m_decoded_frames.load(), size, decode_time_us / 1000, size / bytes_per_ms * 1000. / decode_time_us,
+			min_lead == umax ? std::string("n/a") : fmt::format("%.1f ms", min_lead / bytes_per_ms), m_reader_stalls.load());
+
+		m_decoded_frames = 0;
+		m_decode_time_us = 0;
+		m_min_read_lead = umax;
+		m_reader_stalls = 0;
+	}
+
 	void audio_decoder::decode()
 	{
 		stop();
@@ -358,16 +399,30 @@ namespace utils
 			}
 
 			duration_ms = stream->duration / 1000;
-			
+
+			constexpr u64 bytes_per_sample = dst_channels * sizeof(f32);
+
+			// Reserve the whole track up front so appending frames never reallocates (and copies) the buffer while the reader waits on m_mtx
+			if (av.format->duration > 0)
+			{
+				const u64 expected_size = std::min<u64>(av.format->duration * sample_rate / AV_TIME_BASE * bytes_per_sample, max_reserved_size);
+
+				std::scoped_lock lock(m_mtx);
+				data.reserve(m_size + expected_size);
+			}
+
 			AVPacket packet{};
 			av_init_packet(&packet);
 
 			// Iterate through frames
 			while (thread_ctrl::state() != thread_state::aborting && av_read_frame(av.format, &packet) >= 0)
 			{
-				if (int err = avcodec_send_packet(av.context, &packet); err < 0)
+				const int send_err = avcodec_send_packet(av.context, &packet);
+				av_packet_unref(&packet);
+
+				if (send_err < 0)
 				{
-					media_log.error("audio_decoder: Queuing error: %d='%s'", err, av_error_to_string(err));
+					media_log.error("audio_decoder: Queuing error: %d='%s'", send_err, av_error_to_string(send_err));
 					has_error = true;
 					return;
 				}
@@ -384,59 +439,55 @@ namespace utils
 						return;
 					}
 
-					// Resample frames
-					u8* buffer;
-					const int align = 1;
-					const int buffer_size = av_samples_alloc(&buffer, nullptr, dst_channels, av.frame->nb_samples, dst_format, align);
-					if (buffer_size < 0)
+					// Make room behind the published data. Only this thread resizes the buffer and readers never look past m_size,
+					// so the resampler can write into the tail without holding the lock.
+					const int max_frame_count = swr_get_out_samples(av.swr, av.frame->nb_samples);
+					if (max_frame_count < 0)
 					{
-						media_log.error("audio_decoder: Error allocating buffer: %d='%s'", buffer_size, av_error_to_string(buffer_size));
+						media_log.error("audio_decoder: Error estimating output size: %d='%s'", max_frame_count, av_error_to_string(max_frame_count));
 						has_error = true;
 						return;
 					}
 
-					const int frame_count = swr_convert(av.swr, &buffer, av.frame->nb_samples, const_cast<const uint8_t**>(av.frame->data), av.frame->nb_samples);
+					u8* buffer;
+					{
+						std::scoped_lock lock(m_mtx);
+						data.resize(m_size + max_frame_count * bytes_per_sample);
+						buffer = data.data() + m_size;
+					}
+
+					const int frame_count = swr_convert(av.swr, &buffer, max_frame_count, const_cast<const uint8_t**>(av.frame->data), av.frame->nb_samples);
 					if (frame_count < 0)
 					{
 						media_log.error("audio_decoder: Error converting frame: %d='%s'", frame_count, av_error_to_string(frame_count));
 						has_error = true;
-						if (buffer)
-							av_free(buffer);
 						return;
 					}
 
-					// Append resampled frames to data
+					const u64 buffer_size = frame_count * bytes_per_sample;
+
+					if (m_swap_endianness)
 					{
-						std::scoped_lock lock(m_mtx);
-						data.resize(m_size + buffer_size);
+						// The format is float 32bit per channel
+						u32* samples = reinterpret_cast<u32*>(buffer);
 
-						if (m_swap_endianness)
-						{
-							// The format is float 32bit per channel.
-							const auto write_byteswapped = [](const void* src, void* dst) -> void
-							{
-								*static_cast<f32*>(dst) = *static_cast<const be_t<f32>*>(src);
-							};
-
-							for (size_t i = 0; i < (buffer_size - sizeof(f32)); i += sizeof(f32))
-							{
-								write_byteswapped(buffer + i, data.data() + m_size + i);
-							}
-						}
-						else
+						for (u64 i = 0; i < buffer_size / sizeof(u32); i++)
 						{
-							memcpy(&data[m_size], buffer, buffer_size);
+							samples[i] = stx::se_storage<u32>::swap(samples[i]);
 						}
+					}
 
+					// Publish the new samples
+					{
+						std::scoped_lock lock(m_mtx);
 						const u32 timestamp_ms = stream->time_base.den ? (1000 * av.frame->best_effort_timestamp * stream->time_base.num) / stream->time_base.den : 0;
 						timestamps_ms.push_back({m_size, timestamp_ms});
 						m_size += buffer_size;
 					}
 
-					if (buffer)
-						av_free(buffer);
+					m_decoded_frames++;
 
-					media_log.notice("audio_decoder: decoded frame_count=%d buffer_size=%d timestamp_us=%d", frame_count, buffer_size, av.frame->best_effort_timestamp);
+					media_log.trace("audio_decoder: decoded frame_count=%d buffer_size=%d timestamp_us=%d", frame_count, buffer_size, av.frame->best_effort_timestamp);
 				}
 			}
 		};
@@ -470,7 +521,14 @@ namespace utils
 				ensure(m_context.current_track < m_context.playlist.size());
 				media_log.notice("audio_decoder: about to decode: %s (index=%d)", m_context.playlist.at(m_context.current_track), m_context.current_track);
 
-				decode_track(m_context.playlist.at(m_context.current_track));
+				const std::string& path = m_context.playlist.at(m_context.current_track);
+				const auto start = std::chrono::steady_clock::now();
+
+				decode_track(path);
+
+				m_decode_time_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+				log_track_stats(path);
+
 				track_fully_decoded = true;
 
 				if (has_error)
@@ -61,6 +61,9 @@ namespace utils
 		void decode();
 		u32 set_next_index(bool next);
 
+		// Records how far decoding runs ahead of the reader. Call with m_mtx locked.
+		void update_read_stats(u64 read_pos);
+
 		shared_mutex m_mtx;
 		const s32 sample_rate = 48000;
 		std::vector<u8> data;
@@ -72,6 +75,14 @@ namespace utils
 		std::deque<std::pair<u64, u64>> timestamps_ms;
 
 	private:
+		void log_track_stats(const std::string& path);
+
+		// Per track statistics
+		atomic_t<u64> m_decoded_frames = 0;
+		atomic_t<u64> m_decode_time_us = 0;
+		atomic_t<u64> m_min_read_lead = umax; // Smallest amount of decoded bytes ahead of the reader while the track was still decoding
+		atomic_t<u32> m_reader_stalls = 0; // Reads that caught up with the decoder
+
 		bool m_swap_endianness = false;
 		music_selection_context m_context{};
 		std::unique_ptr<named_thread<std::function<void()>>> m_thread;